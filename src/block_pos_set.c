@@ -0,0 +1,135 @@
+#include "block_pos_set.h"
+#include <stdlib.h>
+#include <string.h>
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions
+//----------------------------------------------------------------------------------
+// x/z biased into 21 bits each, y in 7 bits, top bit set so no key is ever 0
+static unsigned long long PackBlockPos(BlockPos position) {
+    return (1ull << 63) |
+           ((unsigned long long)((position.x + (1 << 20)) & 0x1FFFFF) << 28) |
+           ((unsigned long long)((position.z + (1 << 20)) & 0x1FFFFF) << 7) |
+           (unsigned long long)(position.y & 0x7F);
+}
+
+static int GetKeySlot(const BlockPosSet* set, unsigned long long key) {
+    return (int)((key*0x9E3779B97F4A7C15ull) >> 32) & (set->capacity - 1);
+}
+
+static void GrowBlockPosSet(BlockPosSet* set) {
+    BlockPosSet grown = { 0 };
+    grown.capacity = (set->capacity > 0)? set->capacity*2 : 4096;
+    grown.keys = (unsigned long long*)calloc(grown.capacity, sizeof(unsigned long long));
+    grown.values = (int*)calloc(grown.capacity, sizeof(int));
+
+    for (int i = 0; i < set->capacity; i++) {
+        if (set->keys[i] == 0) continue;
+
+        int slot = GetKeySlot(&grown, set->keys[i]);
+        while (grown.keys[slot] != 0) slot = (slot + 1) & (grown.capacity - 1);
+        grown.keys[slot] = set->keys[i];
+        grown.values[slot] = set->values[i];
+        grown.count++;
+    }
+
+    free(set->keys);
+    free(set->values);
+    *set = grown;
+}
+
+// Slot holding a position, inserted with value 0 if missing
+static int FindOrInsertSlot(BlockPosSet* set, BlockPos position, bool* inserted) {
+    if ((set->count + 1)*2 > set->capacity) GrowBlockPosSet(set);
+
+    unsigned long long key = PackBlockPos(position);
+    int slot = GetKeySlot(set, key);
+    while (set->keys[slot] != 0) {
+        if (set->keys[slot] == key) {
+            *inserted = false;
+            return slot;
+        }
+        slot = (slot + 1) & (set->capacity - 1);
+    }
+
+    set->keys[slot] = key;
+    set->values[slot] = 0;
+    set->count++;
+    *inserted = true;
+    return slot;
+}
+
+static int FindSlot(const BlockPosSet* set, BlockPos position) {
+    if (set->capacity == 0) return -1;
+
+    unsigned long long key = PackBlockPos(position);
+    int slot = GetKeySlot(set, key);
+    while (set->keys[slot] != 0) {
+        if (set->keys[slot] == key) return slot;
+        slot = (slot + 1) & (set->capacity - 1);
+    }
+    return -1;
+}
+
+//----------------------------------------------------------------------------------
+// Block Position Set Functions
+//----------------------------------------------------------------------------------
+bool InsertBlockPos(BlockPosSet* set, BlockPos position) {
+    bool inserted;
+    FindOrInsertSlot(set, position, &inserted);
+    return inserted;
+}
+
+// Linear probing removal: shift later entries of the cluster back into the hole
+void RemoveBlockPos(BlockPosSet* set, BlockPos position) {
+    if (set->capacity == 0) return;
+
+    unsigned long long key = PackBlockPos(position);
+    int mask = set->capacity - 1;
+    int slot = GetKeySlot(set, key);
+    while (set->keys[slot] != key) {
+        if (set->keys[slot] == 0) return;
+        slot = (slot + 1) & mask;
+    }
+
+    int hole = slot;
+    for (int next = (hole + 1) & mask; set->keys[next] != 0; next = (next + 1) & mask) {
+        int home = GetKeySlot(set, set->keys[next]);
+
+        // Entry may move only if the hole lies between its home slot and its position
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            set->keys[hole] = set->keys[next];
+            set->values[hole] = set->values[next];
+            hole = next;
+        }
+    }
+
+    set->keys[hole] = 0;
+    set->count--;
+}
+
+bool ContainsBlockPos(const BlockPosSet* set, BlockPos position) {
+    return FindSlot(set, position) >= 0;
+}
+
+void SetBlockPosValue(BlockPosSet* set, BlockPos position, int value) {
+    bool inserted;
+    int slot = FindOrInsertSlot(set, position, &inserted);     // May grow the table
+    set->values[slot] = value;
+}
+
+int GetBlockPosValue(const BlockPosSet* set, BlockPos position, int missing) {
+    int slot = FindSlot(set, position);
+    return (slot >= 0)? set->values[slot] : missing;
+}
+
+void ClearBlockPosSet(BlockPosSet* set) {
+    if (set->keys) memset(set->keys, 0, set->capacity*sizeof(unsigned long long));
+    set->count = 0;
+}
+
+void UnloadBlockPosSet(BlockPosSet* set) {
+    free(set->keys);
+    free(set->values);
+    *set = (BlockPosSet){0};
+}
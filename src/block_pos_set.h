@@ -0,0 +1,35 @@
+#ifndef BLOCK_POS_SET_H
+#define BLOCK_POS_SET_H
+
+#include "voxel_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Block Position Set
+// NOTE: Open addressing hash set of world block positions (x/z within +-2^20), used by
+// the fluid and block tick schedulers to keep a position queued at most once, and with
+// the per-position values as a position -> index map (redstone component lookup)
+//----------------------------------------------------------------------------------
+typedef struct {
+    unsigned long long* keys;       // Packed positions, 0 marks an empty slot
+    int* values;                    // Value of each slot, 0 for positions added by InsertBlockPos()
+    int capacity;                   // Power of two
+    int count;
+} BlockPosSet;
+
+bool InsertBlockPos(BlockPosSet* set, BlockPos position);     // Returns false if already present
+void RemoveBlockPos(BlockPosSet* set, BlockPos position);
+bool ContainsBlockPos(const BlockPosSet* set, BlockPos position);
+void SetBlockPosValue(BlockPosSet* set, BlockPos position, int value);         // Inserts if missing
+int GetBlockPosValue(const BlockPosSet* set, BlockPos position, int missing);  // missing if not present
+void ClearBlockPosSet(BlockPosSet* set);                        // Keeps the storage
+void UnloadBlockPosSet(BlockPosSet* set);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLOCK_POS_SET_H
@@ -0,0 +1,352 @@
+#include "block_ticks.h"
+#include "block_pos_set.h"
+#include "fluid_system.h"
+#include "redstone.h"
+#include "world_lighting.h"
+#include "platform_threads.h"
+#include "raylib.h"
+#include <stdlib.h>
+
+/*
+---------------------------------------------------------------------------------
+Block Tick System
+
+Block behaviour driven by two kinds of ticks, neither of which scans loaded chunks:
+
+Scheduled ticks are requested for one position at a future world tick (sand and gravel
+noticing they lost support, a crop checking its soil). They live in a binary min-heap keyed
+by (due tick, submission order), so ticks due on the same tick run in request order, and a
+BlockPosSet keeps each position scheduled at most once. Block changes wake their neighbors
+through NotifyBlockChanged(), which schedules the blocks that react to neighbor changes and
+forwards the change to the fluid and redstone systems. At most MAX_SCHEDULED_TICKS_PER_TICK
+run per tick, overflow stays in the heap for the next tick.
+
+Random ticks sample RANDOM_TICKS_PER_SECTION random positions per chunk section and tick,
+but only in sections whose randomTickBlocks count (kept up to date by the world on every
+block write) is non zero. Sections of plain stone or air cost one counter check, so the
+cost follows the amount of grass, leaves, crops and ice instead of the loaded volume.
+
+    Grass   spreads to nearby lit dirt, turns to dirt in the dark (under opaque blocks) or water
+    Leaves  decay when no log is within LEAF_DECAY_DISTANCE (unless player placed)
+    Wheat   grows through its 8 stages in light of CROP_MIN_LIGHT or more
+    Ice     melts in bright block light (glowstone, sea lanterns, jack o'lanterns nearby)
+
+---------------------------------------------------------------------------------
+*/
+
+//----------------------------------------------------------------------------------
+// Local Constants
+//----------------------------------------------------------------------------------
+#define GRASS_SPREAD_ATTEMPTS   4
+#define CROP_GROWTH_CHANCE      3       // One random tick in this many advances a crop stage
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct {
+    BlockPos position;
+    unsigned int dueTick;           // World tick the tick runs at
+    unsigned int order;             // Submission order, breaks ties between equal due ticks
+} ScheduledTick;
+
+//----------------------------------------------------------------------------------
+// Local Variables
+//----------------------------------------------------------------------------------
+static ScheduledTick* heap = NULL;      // Binary min-heap of scheduled ticks
+static int heapCount = 0;
+static int heapCapacity = 0;
+static BlockPosSet scheduledCells = {0};    // Positions currently in the heap
+static unsigned int nextOrder = 0;
+static unsigned int randomState = 0x9E3779B9u;
+static BlockTickStats stats = {0};
+
+static const BlockPos neighborOffsets[6] = { {-1, 0, 0}, {1, 0, 0}, {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1} };
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions
+//----------------------------------------------------------------------------------
+static unsigned int NextRandom(void) {
+    // xorshift32, cheap and good enough for sampling positions
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+// Wrap-safe ordering of scheduled ticks
+static bool IsTickBefore(const ScheduledTick* a, const ScheduledTick* b) {
+    int dueDelta = (int)(a->dueTick - b->dueTick);
+    if (dueDelta != 0) return dueDelta < 0;
+    return (int)(a->order - b->order) < 0;
+}
+
+static void PushScheduledTick(ScheduledTick tick) {
+    if (heapCount >= heapCapacity) {
+        heapCapacity = (heapCapacity > 0)? heapCapacity*2 : 1024;
+        heap = (ScheduledTick*)realloc(heap, heapCapacity*sizeof(ScheduledTick));
+    }
+
+    // Sift up
+    int index = heapCount++;
+    while (index > 0) {
+        int parent = (index - 1)/2;
+        if (!IsTickBefore(&tick, &heap[parent])) break;
+        heap[index] = heap[parent];
+        index = parent;
+    }
+    heap[index] = tick;
+}
+
+static ScheduledTick PopScheduledTick(void) {
+    ScheduledTick top = heap[0];
+    ScheduledTick last = heap[--heapCount];
+
+    // Sift the last entry down from the root
+    int index = 0;
+    while (true) {
+        int child = index*2 + 1;
+        if (child >= heapCount) break;
+        if ((child + 1 < heapCount) && IsTickBefore(&heap[child + 1], &heap[child])) child++;
+        if (!IsTickBefore(&heap[child], &last)) break;
+        heap[index] = heap[child];
+        index = child;
+    }
+    if (heapCount > 0) heap[index] = last;
+
+    return top;
+}
+
+static bool IsFallingBlock(BlockType block) {
+    return (block == BLOCK_SAND) || (block == BLOCK_RED_SAND) || (block == BLOCK_GRAVEL);
+}
+
+static bool IsLogBlock(BlockType block) {
+    return (block == BLOCK_OAK_LOG) || (block == BLOCK_BIRCH_LOG) ||
+           (block == BLOCK_ACACIA_LOG) || (block == BLOCK_DARK_OAK_LOG);
+}
+
+// Brighter of the sky and block light at a position, unloaded chunks and the space above the world read as open sky
+static int GetLightCached(VoxelWorld* world, BlockLookupCache* cache, int x, int y, int z) {
+    if (y >= WORLD_HEIGHT) return MAX_LIGHT_LEVEL;
+    if (y < 0) return 0;
+    GetBlockCached(world, cache, x, y, z);
+    if (!cache->chunk) return MAX_LIGHT_LEVEL;
+
+    int localX = x - cache->position.x*CHUNK_SIZE;
+    int localZ = z - cache->position.z*CHUNK_SIZE;
+    int skyLevel = GetChunkLight(cache->chunk, LIGHT_SKY, localX, y, localZ);
+    int blockLevel = GetChunkLight(cache->chunk, LIGHT_BLOCK, localX, y, localZ);
+    return (skyLevel > blockLevel)? skyLevel : blockLevel;
+}
+
+// Grass needs GRASS_MIN_LIGHT in the cell above it and no water on top
+// NOTE: Opaque blocks hold no light in their own cell, so covering grass with one still kills it
+static bool CanGrassLive(VoxelWorld* world, BlockLookupCache* cache, int x, int y, int z) {
+    if (GetBlockCached(world, cache, x, y + 1, z) == BLOCK_WATER) return false;
+    return GetLightCached(world, cache, x, y + 1, z) >= GRASS_MIN_LIGHT;
+}
+
+// Any block of the cube around a position matching a predicate, unloadedMatches decides for unloaded space
+static bool IsBlockNearby(VoxelWorld* world, BlockLookupCache* cache, int x, int y, int z, int radius,
+                          bool (*predicate)(BlockType), bool unloadedMatches) {
+    for (int dx = -radius; dx <= radius; dx++) {
+        for (int dz = -radius; dz <= radius; dz++) {
+            for (int dy = -radius; dy <= radius; dy++) {
+                BlockType block = GetBlockCached(world, cache, x + dx, y + dy, z + dz);
+                if (!cache->chunk) {
+                    if (unloadedMatches) return true;
+                } else if (predicate(block)) return true;
+            }
+        }
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------------
+// Block Behaviours
+//----------------------------------------------------------------------------------
+static void TickGrass(VoxelWorld* world, BlockLookupCache* cache, int x, int y, int z) {
+    if (!CanGrassLive(world, cache, x, y, z)) {
+        SetBlockCached(world, cache, x, y, z, BLOCK_DIRT, 0);
+        return;
+    }
+
+    // Spread to dirt in the 3x5x3 box around (one above to three below)
+    for (int i = 0; i < GRASS_SPREAD_ATTEMPTS; i++) {
+        unsigned int r = NextRandom();
+        int tx = x + (int)(r % 3) - 1;
+        int ty = y + (int)((r >> 4) % 5) - 3;
+        int tz = z + (int)((r >> 8) % 3) - 1;
+
+        if ((GetBlockCached(world, cache, tx, ty, tz) == BLOCK_DIRT) &&
+            CanGrassLive(world, cache, tx, ty, tz)) {
+            SetBlockCached(world, cache, tx, ty, tz, BLOCK_GRASS, 0);
+        }
+    }
+}
+
+static void TickLeaves(VoxelWorld* world, BlockLookupCache* cache, int x, int y, int z, unsigned char data) {
+    if (data & LEAVES_PERSISTENT) return;
+
+    // A log in an unloaded chunk may hold the leaves, keep them until it is known
+    if (IsBlockNearby(world, cache, x, y, z, LEAF_DECAY_DISTANCE, IsLogBlock, true)) return;
+
+    SetBlockCached(world, cache, x, y, z, BLOCK_AIR, 0);
+    NotifyBlockChanged(world, (BlockPos){ x, y, z });
+}
+
+static void TickWheat(VoxelWorld* world, BlockLookupCache* cache, int x, int y, int z, unsigned char data) {
+    if ((data >= WHEAT_MAX_STAGE) || (NextRandom() % CROP_GROWTH_CHANCE != 0)) return;
+    if (GetLightCached(world, cache, x, y, z) < CROP_MIN_LIGHT) return;
+    SetBlockCached(world, cache, x, y, z, BLOCK_WHEAT, data + 1);
+}
+
+static void TickIce(VoxelWorld* world, BlockLookupCache* cache, int x, int y, int z) {
+    // Sunlight alone never melts ice, only light from emitting blocks
+    GetBlockCached(world, cache, x, y, z);
+    if (!cache->chunk) return;
+    int level = GetChunkLight(cache->chunk, LIGHT_BLOCK, x - cache->position.x*CHUNK_SIZE, y, z - cache->position.z*CHUNK_SIZE);
+    if (level <= ICE_MELT_LIGHT) return;
+
+    SetBlockCached(world, cache, x, y, z, BLOCK_WATER, 0);
+    NotifyBlockChanged(world, (BlockPos){ x, y, z });
+}
+
+static void RunRandomTick(VoxelWorld* world, BlockLookupCache* cache, int x, int y, int z, BlockType block, unsigned char data) {
+    switch (block) {
+        case BLOCK_GRASS: TickGrass(world, cache, x, y, z); break;
+        case BLOCK_OAK_LEAVES:
+        case BLOCK_BIRCH_LEAVES:
+        case BLOCK_ACACIA_LEAVES:
+        case BLOCK_DARK_OAK_LEAVES: TickLeaves(world, cache, x, y, z, data); break;
+        case BLOCK_WHEAT: TickWheat(world, cache, x, y, z, data); break;
+        case BLOCK_ICE: TickIce(world, cache, x, y, z); break;
+        default: break;
+    }
+}
+
+static void RunScheduledTick(VoxelWorld* world, BlockLookupCache* cache, BlockPos position) {
+    BlockType block = GetBlockCached(world, cache, position.x, position.y, position.z);
+    if (!cache->chunk || (position.y <= 0)) return;
+
+    BlockType below = GetBlockCached(world, cache, position.x, position.y - 1, position.z);
+    if (!cache->chunk) return;      // Never move blocks into unloaded space
+
+    BlockPos belowPos = { position.x, position.y - 1, position.z };
+
+    if (IsFallingBlock(block) && ((below == BLOCK_AIR) || (below == BLOCK_WATER))) {
+        // Drop one block, the new position schedules itself again through the notification
+        SetBlockCached(world, cache, position.x, position.y, position.z, BLOCK_AIR, 0);
+        SetBlockCached(world, cache, belowPos.x, belowPos.y, belowPos.z, block, 0);
+        NotifyBlockChanged(world, position);
+        NotifyBlockChanged(world, belowPos);
+    } else if ((block == BLOCK_WHEAT) && (below != BLOCK_DIRT) && (below != BLOCK_GRASS)) {
+        // Crops pop off without soil
+        SetBlockCached(world, cache, position.x, position.y, position.z, BLOCK_AIR, 0);
+        NotifyBlockChanged(world, position);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Block Tick Functions
+//----------------------------------------------------------------------------------
+void InitBlockTicks(void) {
+    heapCount = 0;
+    nextOrder = 0;
+    ClearBlockPosSet(&scheduledCells);
+    stats = (BlockTickStats){0};
+}
+
+void UnloadBlockTicks(void) {
+    free(heap);
+    heap = NULL;
+    heapCount = 0;
+    heapCapacity = 0;
+    UnloadBlockPosSet(&scheduledCells);
+    stats = (BlockTickStats){0};
+}
+
+void ScheduleBlockTick(VoxelWorld* world, BlockPos position, int delay) {
+    if (!InsertBlockPos(&scheduledCells, position)) return;     // Already pending
+    PushScheduledTick((ScheduledTick){ position, world->tickCount + (unsigned int)delay, nextOrder++ });
+}
+
+void NotifyBlockChanged(VoxelWorld* world, BlockPos position) {
+    BlockLookupCache cache = { 0 };
+
+    for (int i = -1; i < 6; i++) {
+        BlockPos cell = position;
+        if (i >= 0) {
+            cell.x += neighborOffsets[i].x;
+            cell.y += neighborOffsets[i].y;
+            cell.z += neighborOffsets[i].z;
+        }
+
+        BlockType block = GetBlockCached(world, &cache, cell.x, cell.y, cell.z);
+        if (IsFallingBlock(block)) ScheduleBlockTick(world, cell, FALLING_BLOCK_DELAY);
+        else if (block == BLOCK_WHEAT) ScheduleBlockTick(world, cell, CROP_CHECK_DELAY);
+    }
+
+    NotifyFluidNeighbors(world, position);
+    OnRedstoneBlockChanged(world, position);
+}
+
+void UpdateBlockTicks(VoxelWorld* world) {
+    double startTime = GetTime();
+    BlockLookupCache cache = { 0 };
+
+    BlockTickStats tickStats = { 0 };
+
+    // Scheduled ticks due by now, earliest first
+    while ((heapCount > 0) && (tickStats.scheduledRun < MAX_SCHEDULED_TICKS_PER_TICK) &&
+           ((int)(heap[0].dueTick - world->tickCount) <= 0)) {
+        ScheduledTick tick = PopScheduledTick();
+        RemoveBlockPos(&scheduledCells, tick.position);
+        RunScheduledTick(world, &cache, tick.position);
+        tickStats.scheduledRun++;
+    }
+
+    // Random ticks, only in sections that contain something to tick
+    for (int i = 0; i < MAX_CHUNKS; i++) {
+        Chunk* chunk = &world->chunks[i];
+        if (!chunk->isLoaded || (AtomicLoad(&chunk->genState) != CHUNK_GEN_READY)) continue;
+
+        for (int s = 0; s < CHUNK_SECTIONS; s++) {
+            if (chunk->randomTickBlocks[s] == 0) continue;
+            tickStats.randomSections++;
+
+            for (int k = 0; k < RANDOM_TICKS_PER_SECTION; k++) {
+                unsigned int r = NextRandom();
+                int x = r & (CHUNK_SIZE - 1);
+                int z = (r >> 4) & (CHUNK_SIZE - 1);
+                int y = s*CHUNK_SECTION_HEIGHT + (int)((r >> 8) % CHUNK_SECTION_HEIGHT);
+
+                BlockType block = chunk->blocks[x][y][z];
+                if (!IsBlockRandomTicked(block)) continue;
+
+                RunRandomTick(world, &cache, chunk->position.x*CHUNK_SIZE + x, y, chunk->position.z*CHUNK_SIZE + z,
+                              block, chunk->blockData[x][y][z]);
+                tickStats.randomTicks++;
+            }
+        }
+    }
+
+    tickStats.scheduledPending = heapCount;
+    tickStats.updateTime = (float)((GetTime() - startTime)*1000.0);
+    stats = tickStats;
+}
+
+unsigned char GetPlacedBlockData(BlockType block) {
+    switch (block) {
+        case BLOCK_OAK_LEAVES:
+        case BLOCK_BIRCH_LEAVES:
+        case BLOCK_ACACIA_LEAVES:
+        case BLOCK_DARK_OAK_LEAVES: return LEAVES_PERSISTENT;
+        case BLOCK_REDSTONE_TORCH: return REDSTONE_POWERED;     // Placed lit, the graph turns it off if needed
+        default: return 0;
+    }
+}
+
+BlockTickStats GetBlockTickStats(void) {
+    return stats;
+}
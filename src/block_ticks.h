@@ -0,0 +1,51 @@
+#ifndef BLOCK_TICKS_H
+#define BLOCK_TICKS_H
+
+#include "voxel_types.h"
+#include "voxel_world.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Block Tick Constants
+//----------------------------------------------------------------------------------
+#define RANDOM_TICKS_PER_SECTION        1       // Samples per section and tick (Minecraft's 3 per 20 Hz tick at 60 Hz)
+#define MAX_SCHEDULED_TICKS_PER_TICK    1024    // Due scheduled ticks run per tick, the rest waits
+#define FALLING_BLOCK_DELAY             6       // Ticks before sand and gravel drop one block
+#define CROP_CHECK_DELAY                1       // Ticks before a crop checks the block under it
+#define LEAF_DECAY_DISTANCE             4       // Leaves further than this from a log decay
+#define ICE_MELT_LIGHT                  11      // Ice melts in block light brighter than this
+#define GRASS_MIN_LIGHT                 4       // Grass dies below this light level above it, and only spreads where it is met
+#define CROP_MIN_LIGHT                  9       // Crops only grow at this light level or brighter
+
+// Block data of leaves
+#define LEAVES_PERSISTENT               0x01    // Placed by the player, never decays
+
+#define WHEAT_MAX_STAGE                 7
+
+typedef struct {
+    int scheduledPending;       // Scheduled ticks waiting in the queue
+    int scheduledRun;           // Scheduled ticks run in the last tick
+    int randomSections;         // Sections sampled in the last tick (sections with random ticked blocks)
+    int randomTicks;            // Random samples that hit a random ticked block
+    float updateTime;           // Milliseconds spent in the last UpdateBlockTicks() call
+} BlockTickStats;
+
+//----------------------------------------------------------------------------------
+// Block Tick Functions (simulation thread)
+//----------------------------------------------------------------------------------
+void InitBlockTicks(void);                                              // Also drops pending ticks
+void UnloadBlockTicks(void);
+void UpdateBlockTicks(VoxelWorld* world);                               // Called once per simulation tick
+void ScheduleBlockTick(VoxelWorld* world, BlockPos position, int delay);
+void NotifyBlockChanged(VoxelWorld* world, BlockPos position);          // Wake neighbors (gravity, crops, fluids, redstone)
+unsigned char GetPlacedBlockData(BlockType block);                      // Block data for a player placed block
+BlockTickStats GetBlockTickStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BLOCK_TICKS_H
@@ -0,0 +1,133 @@
+#include "entity_renderer.h"
+#include "render_stats.h"
+#include "voxel_renderer.h"
+#include "rlgl.h"
+#include <stdio.h>
+
+/*
+---------------------------------------------------------------------------------
+Entity Renderer
+
+Draws the entity snapshot of a frame as textured unit cubes, one instanced draw call
+per entity type: the simulation thread already grouped the instance transforms by type,
+so the main thread only binds a material and submits the batch. The head front of each
+entity skin is cropped and used on every cube face.
+
+Instancing needs a shader reading the per-instance matrix; if it fails to load entities
+fall back to one draw call per entity with the default shader.
+
+---------------------------------------------------------------------------------
+*/
+
+//----------------------------------------------------------------------------------
+// Local Constants and Macros
+//----------------------------------------------------------------------------------
+#if defined(PLATFORM_WEB)
+    #define GLSL_VERSION 100
+#else
+    #define GLSL_VERSION 330
+#endif
+
+//----------------------------------------------------------------------------------
+// Local Variables
+//----------------------------------------------------------------------------------
+static Mesh cubeMesh = { 0 };
+static Shader instancingShader = { 0 };
+static Material typeMaterials[ENTITY_TYPE_COUNT] = { 0 };
+static bool instancingAvailable = false;
+static bool entityRendererReady = false;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions
+//----------------------------------------------------------------------------------
+static Texture2D LoadEntityFaceTexture(const EntityTypeInfo* info) {
+    char path[256];
+    Image face = { 0 };
+
+    if (FindResourcePath(TextFormat("textures/entity/%s", info->texture), path, sizeof(path))) {
+        Image skin = LoadImage(path);
+        if (skin.data) face = ImageFromImage(skin, info->face);
+        UnloadImage(skin);
+    }
+
+    // Missing skin: flat placeholder, same as missing block textures
+    if (!face.data) face = GenImageColor(8, 8, PINK);
+
+    Texture2D texture = LoadTextureFromImage(face);
+    SetTextureFilter(texture, TEXTURE_FILTER_POINT);
+    UnloadImage(face);
+    return texture;
+}
+
+//----------------------------------------------------------------------------------
+// Entity Rendering Functions
+//----------------------------------------------------------------------------------
+void InitEntityRenderer(void) {
+    if (entityRendererReady) return;
+
+    cubeMesh = GenMeshCube(1.0f, 1.0f, 1.0f);
+
+    char vsPath[256];
+    char fsPath[256];
+    bool shaderFound = FindResourcePath(TextFormat("shaders/glsl%i/entity_instanced.vs", GLSL_VERSION), vsPath, sizeof(vsPath)) &&
+                       FindResourcePath(TextFormat("shaders/glsl%i/entity_instanced.fs", GLSL_VERSION), fsPath, sizeof(fsPath));
+
+    instancingAvailable = false;
+    if (shaderFound) {
+        instancingShader = LoadShader(vsPath, fsPath);
+        if (instancingShader.id != rlGetShaderIdDefault()) {
+            instancingShader.locs[SHADER_LOC_MATRIX_MVP] = GetShaderLocation(instancingShader, "mvp");
+            instancingShader.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(instancingShader, "instanceTransform");
+            instancingAvailable = true;
+        }
+    }
+
+    for (int t = 0; t < ENTITY_TYPE_COUNT; t++) {
+        typeMaterials[t] = LoadMaterialDefault();
+        if (instancingAvailable) typeMaterials[t].shader = instancingShader;
+        SetMaterialTexture(&typeMaterials[t], MATERIAL_MAP_DIFFUSE, LoadEntityFaceTexture(GetEntityTypeInfo((EntityType)t)));
+    }
+
+    printf("Entity renderer: %s\n", instancingAvailable? "instanced" : "instancing shader unavailable, drawing per entity");
+    entityRendererReady = true;
+}
+
+void UnloadEntityRenderer(void) {
+    if (!entityRendererReady) return;
+
+    // NOTE: Materials share one shader, free their parts individually instead of UnloadMaterial()
+    for (int t = 0; t < ENTITY_TYPE_COUNT; t++) {
+        UnloadTexture(typeMaterials[t].maps[MATERIAL_MAP_DIFFUSE].texture);
+        RL_FREE(typeMaterials[t].maps);
+        typeMaterials[t] = (Material){ 0 };
+    }
+
+    if (instancingAvailable) UnloadShader(instancingShader);
+    instancingShader = (Shader){ 0 };
+    UnloadMesh(cubeMesh);
+    cubeMesh = (Mesh){ 0 };
+
+    instancingAvailable = false;
+    entityRendererReady = false;
+}
+
+void DrawEntities(const EntityRenderList* list) {
+    if (!entityRendererReady || !list->transforms) return;
+
+    for (int t = 0; t < ENTITY_TYPE_COUNT; t++) {
+        int count = list->typeCount[t];
+        if (count == 0) continue;
+
+        const Matrix* transforms = &list->transforms[list->typeStart[t]];
+
+        if (instancingAvailable) {
+            DrawMeshInstanced(cubeMesh, typeMaterials[t], transforms, count);
+            RenderStatsAddDrawCall(RENDER_PASS_OPAQUE, cubeMesh.vertexCount*count, cubeMesh.triangleCount*count);
+        } else {
+            for (int i = 0; i < count; i++) {
+                DrawMesh(cubeMesh, typeMaterials[t], transforms[i]);
+                RenderStatsAddDrawCall(RENDER_PASS_OPAQUE, cubeMesh.vertexCount, cubeMesh.triangleCount);
+            }
+        }
+    }
+}
@@ -0,0 +1,21 @@
+#ifndef ENTITY_RENDERER_H
+#define ENTITY_RENDERER_H
+
+#include "entity_system.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Entity Rendering Functions (main thread only)
+//----------------------------------------------------------------------------------
+void InitEntityRenderer(void);
+void UnloadEntityRenderer(void);
+void DrawEntities(const EntityRenderList* list);     // One instanced draw call per entity type (inside BeginMode3D)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ENTITY_RENDERER_H
@@ -0,0 +1,421 @@
+#include "entity_system.h"
+#include "voxel_collision.h"
+#include "world_generation.h"
+#include "job_system.h"
+#include "raymath.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+/*
+---------------------------------------------------------------------------------
+Entity System
+
+Mobs and other simple moving bodies. Components live in parallel arrays (structure of
+arrays) packed at the front, so every per-tick pass streams through contiguous memory;
+generational handles keep references valid across the swap-remove used on despawn.
+
+Neighbor queries go through a spatial hash of ENTITY_CELL_SIZE columns rebuilt each tick
+with a counting sort (no per-entity allocation). Cells divide CHUNK_SIZE, so a cell never
+spans two chunks.
+
+A tick runs in two batched passes over the job system:
+  1. Steering: wander decisions and separation from neighbors, writes velocities only
+  2. Movement: gravity and swept AABB against the voxel grid, writes positions only
+Each pass only writes the entry it processes and reads data the other pass owns, so
+batches never race. Entities standing in chunks that are not generated stay frozen.
+
+---------------------------------------------------------------------------------
+*/
+
+//----------------------------------------------------------------------------------
+// Local Constants and Macros
+//----------------------------------------------------------------------------------
+#define ENTITY_GRAVITY              20.0f
+#define ENTITY_TERMINAL_VELOCITY    -50.0f
+#define ENTITY_JUMP_VELOCITY        6.5f
+#define ENTITY_STEERING             0.2f    // Fraction of the velocity change applied per tick
+#define ENTITY_SEPARATION           4.0f    // Push speed between fully overlapping entities
+#define ENTITY_MAX_NEIGHBORS        32
+#define ENTITY_KILL_HEIGHT          -32.0f
+
+#define ENTITY_SLOT(id)             ((int)((id) & 0xFFFF))
+#define ENTITY_GENERATION(id)       ((unsigned short)((id) >> 16))
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct {
+    EntityWorld* entities;
+    VoxelWorld* world;
+    float deltaTime;
+    int start;                  // Dense index range processed by this job
+    int end;
+    int pairsTested;
+} EntityBatch;
+
+//----------------------------------------------------------------------------------
+// Local Variables
+//----------------------------------------------------------------------------------
+static const EntityTypeInfo entityTypes[ENTITY_TYPE_COUNT] = {
+    { "Pig",     "pig/pig.png",     { 8, 8, 8, 8 }, 0.9f, 0.9f, 1.2f },
+    { "Cow",     "cow/cow.png",     { 6, 6, 8, 8 }, 0.9f, 1.4f, 1.0f },
+    { "Sheep",   "sheep/sheep.png", { 8, 8, 6, 6 }, 0.9f, 1.3f, 1.1f },
+    { "Chicken", "chicken.png",     { 3, 3, 4, 6 }, 0.4f, 0.7f, 1.4f }
+};
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions
+//----------------------------------------------------------------------------------
+// Deterministic per-entity random numbers, safe to use from jobs
+static float EntityRandom(EntityId id, unsigned int tick, unsigned int salt) {
+    unsigned int h = id*0x9E3779B1u ^ tick*0x85EBCA77u ^ salt*0xC2B2AE3Du;
+    h ^= h >> 15;
+    h *= 0x2C1B3C6Du;
+    h ^= h >> 12;
+    h *= 0x297A2D39u;
+    h ^= h >> 15;
+    return (h & 0xFFFFFF)/16777216.0f;
+}
+
+static int GetCellCoord(float value) {
+    return (int)floorf(value/ENTITY_CELL_SIZE);
+}
+
+static int GetCellBucket(int cellX, int cellZ) {
+    unsigned int h = (unsigned int)cellX*73856093u ^ (unsigned int)cellZ*19349663u;
+    return (int)(h & (ENTITY_HASH_BUCKETS - 1));
+}
+
+static BoundingBox GetEntityBounds(const EntityWorld* entities, int index) {
+    const EntityTypeInfo* info = &entityTypes[entities->type[index]];
+    Vector3 position = entities->position[index];
+    float halfWidth = info->width*0.5f;
+
+    return (BoundingBox){
+        { position.x - halfWidth, position.y, position.z - halfWidth },
+        { position.x + halfWidth, position.y + info->height, position.z + halfWidth }
+    };
+}
+
+static void BuildSpatialHash(EntityWorld* entities) {
+    int cursor[ENTITY_HASH_BUCKETS];
+
+    memset(entities->bucketStart, 0, sizeof(entities->bucketStart));
+
+    for (int i = 0; i < entities->count; i++) {
+        Vector3 position = entities->position[i];
+        entities->bucketStart[GetCellBucket(GetCellCoord(position.x), GetCellCoord(position.z)) + 1]++;
+    }
+
+    for (int b = 0; b < ENTITY_HASH_BUCKETS; b++) {
+        entities->bucketStart[b + 1] += entities->bucketStart[b];
+        cursor[b] = entities->bucketStart[b];
+    }
+
+    for (int i = 0; i < entities->count; i++) {
+        Vector3 position = entities->position[i];
+        int bucket = GetCellBucket(GetCellCoord(position.x), GetCellCoord(position.z));
+        entities->cellEntities[cursor[bucket]++] = i;
+    }
+}
+
+// Wander decisions and separation, velocities only
+static void SteerEntitiesJob(void* userData) {
+    EntityBatch* batch = (EntityBatch*)userData;
+    EntityWorld* entities = batch->entities;
+    int neighbors[ENTITY_MAX_NEIGHBORS];
+
+    for (int i = batch->start; i < batch->end; i++) {
+        const EntityTypeInfo* info = &entityTypes[entities->type[i]];
+        EntityId id = entities->id[i];
+
+        entities->wanderTimer[i] -= batch->deltaTime;
+        if (entities->wanderTimer[i] <= 0.0f) {
+            entities->wanderTimer[i] = 2.0f + 4.0f*EntityRandom(id, entities->tick, 0);
+            entities->walking[i] = (EntityRandom(id, entities->tick, 1) < 0.6f);
+            entities->yaw[i] = 2.0f*PI*EntityRandom(id, entities->tick, 2);
+        }
+
+        Vector3 desired = { 0 };
+        if (entities->walking[i]) {
+            desired.x = sinf(entities->yaw[i])*info->walkSpeed;
+            desired.z = cosf(entities->yaw[i])*info->walkSpeed;
+        }
+
+        Vector3 velocity = entities->velocity[i];
+        velocity.x += (desired.x - velocity.x)*ENTITY_STEERING;
+        velocity.z += (desired.z - velocity.z)*ENTITY_STEERING;
+
+        // Push overlapping neighbors apart (horizontal only)
+        Vector3 position = entities->position[i];
+        int found = QueryEntitiesInRadius(entities, position, info->width, neighbors, ENTITY_MAX_NEIGHBORS);
+        batch->pairsTested += found;
+
+        for (int n = 0; n < found; n++) {
+            int j = neighbors[n];
+            if (j == i) continue;
+
+            float minDistance = (info->width + entityTypes[entities->type[j]].width)*0.5f;
+            float dx = position.x - entities->position[j].x;
+            float dz = position.z - entities->position[j].z;
+            float distance = sqrtf(dx*dx + dz*dz);
+            if (distance >= minDistance) continue;
+
+            float push = ENTITY_SEPARATION*(minDistance - distance)/minDistance;
+
+            // Exactly stacked entities separate along an id based direction
+            if (distance < 0.001f) {
+                float angle = 2.0f*PI*EntityRandom(id, 0, 3);
+                dx = sinf(angle);
+                dz = cosf(angle);
+                distance = 1.0f;
+            }
+
+            velocity.x += dx/distance*push*ENTITY_STEERING;
+            velocity.z += dz/distance*push*ENTITY_STEERING;
+        }
+
+        entities->velocity[i] = velocity;
+    }
+}
+
+// Gravity and swept collision, positions only
+static void MoveEntitiesJob(void* userData) {
+    EntityBatch* batch = (EntityBatch*)userData;
+    EntityWorld* entities = batch->entities;
+    BlockLookupCache lookup = { 0 };
+
+    for (int i = batch->start; i < batch->end; i++) {
+        Vector3 position = entities->position[i];
+        entities->previousPosition[i] = position;
+
+        // Hold entities in place until the terrain under them exists
+        GetBlockCached(batch->world, &lookup, (int)floorf(position.x), 0, (int)floorf(position.z));
+        if (!lookup.chunk) continue;
+
+        Vector3 velocity = entities->velocity[i];
+        velocity.y -= ENTITY_GRAVITY*batch->deltaTime;
+        if (velocity.y < ENTITY_TERMINAL_VELOCITY) velocity.y = ENTITY_TERMINAL_VELOCITY;
+
+        VoxelMoveResult move = MoveBoxThroughWorld(batch->world, GetEntityBounds(entities, i),
+                                                   Vector3Scale(velocity, batch->deltaTime));
+        entities->position[i] = Vector3Add(position, move.motion);
+
+        if (move.hitY) {
+            entities->onGround[i] = (velocity.y < 0.0f);
+            velocity.y = 0.0f;
+        } else {
+            entities->onGround[i] = false;
+        }
+
+        // Walking into a wall: hop up one block
+        if ((move.hitX || move.hitZ) && entities->onGround[i] && entities->walking[i]) {
+            velocity.y = ENTITY_JUMP_VELOCITY;
+        }
+        if (move.hitX) velocity.x = 0.0f;
+        if (move.hitZ) velocity.z = 0.0f;
+
+        entities->velocity[i] = velocity;
+    }
+}
+
+static void RunEntityPass(EntityWorld* entities, VoxelWorld* world, float deltaTime, JobFunc func, int* pairsTested) {
+    static EntityBatch batches[MAX_ENTITIES/ENTITY_JOB_BATCH];
+    JobDecl jobs[MAX_ENTITIES/ENTITY_JOB_BATCH];
+    JobCounter counter = { 0 };
+    int batchCount = 0;
+
+    for (int start = 0; start < entities->count; start += ENTITY_JOB_BATCH) {
+        int end = (start + ENTITY_JOB_BATCH < entities->count)? start + ENTITY_JOB_BATCH : entities->count;
+        batches[batchCount] = (EntityBatch){ entities, world, deltaTime, start, end, 0 };
+        jobs[batchCount] = (JobDecl){ func, &batches[batchCount] };
+        batchCount++;
+    }
+
+    RunJobs(jobs, batchCount, &counter);
+    WaitForCounter(&counter);
+
+    if (pairsTested) {
+        for (int b = 0; b < batchCount; b++) *pairsTested += batches[b].pairsTested;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Entity Functions
+//----------------------------------------------------------------------------------
+void InitEntityWorld(EntityWorld* entities) {
+    memset(entities, 0, sizeof(EntityWorld));
+
+    // Hand out low slots first
+    entities->freeCount = MAX_ENTITIES;
+    for (int i = 0; i < MAX_ENTITIES; i++) {
+        entities->freeSlots[i] = MAX_ENTITIES - 1 - i;
+        entities->denseIndex[i] = -1;
+        entities->generation[i] = 1;
+    }
+}
+
+const EntityTypeInfo* GetEntityTypeInfo(EntityType type) {
+    return &entityTypes[type];
+}
+
+EntityId SpawnEntity(EntityWorld* entities, EntityType type, Vector3 position) {
+    if (entities->freeCount == 0) return ENTITY_INVALID_ID;
+
+    int slot = entities->freeSlots[--entities->freeCount];
+    int index = entities->count++;
+    EntityId id = ((EntityId)entities->generation[slot] << 16) | (EntityId)slot;
+
+    entities->denseIndex[slot] = index;
+    entities->id[index] = id;
+    entities->type[index] = (unsigned char)type;
+    entities->position[index] = position;
+    entities->previousPosition[index] = position;
+    entities->velocity[index] = (Vector3){ 0 };
+    entities->yaw[index] = 2.0f*PI*EntityRandom(id, entities->tick, 4);
+    entities->wanderTimer[index] = 0.0f;
+    entities->walking[index] = false;
+    entities->onGround[index] = false;
+
+    return id;
+}
+
+void DespawnEntity(EntityWorld* entities, EntityId id) {
+    int index = GetEntityIndex(entities, id);
+    if (index < 0) return;
+
+    // Move the last entity into the hole
+    int last = --entities->count;
+    if (index != last) {
+        entities->position[index] = entities->position[last];
+        entities->previousPosition[index] = entities->previousPosition[last];
+        entities->velocity[index] = entities->velocity[last];
+        entities->yaw[index] = entities->yaw[last];
+        entities->wanderTimer[index] = entities->wanderTimer[last];
+        entities->walking[index] = entities->walking[last];
+        entities->onGround[index] = entities->onGround[last];
+        entities->type[index] = entities->type[last];
+        entities->id[index] = entities->id[last];
+        entities->denseIndex[ENTITY_SLOT(entities->id[index])] = index;
+    }
+
+    int slot = ENTITY_SLOT(id);
+    entities->denseIndex[slot] = -1;
+    entities->generation[slot]++;
+    if (entities->generation[slot] == 0) entities->generation[slot] = 1;   // Keep ids non-zero
+    entities->freeSlots[entities->freeCount++] = slot;
+}
+
+int GetEntityIndex(const EntityWorld* entities, EntityId id) {
+    int slot = ENTITY_SLOT(id);
+    if ((id == ENTITY_INVALID_ID) || (slot >= MAX_ENTITIES)) return -1;
+    if (entities->generation[slot] != ENTITY_GENERATION(id)) return -1;
+    return entities->denseIndex[slot];
+}
+
+void UpdateEntities(EntityWorld* entities, VoxelWorld* world, Vector3 playerPosition, float deltaTime) {
+    double startTime = GetTime();
+    int pairsTested = 0;
+
+    // Despawn entities that fell out of the world or were left behind
+    for (int i = entities->count - 1; i >= 0; i--) {
+        Vector3 position = entities->position[i];
+        if ((position.y < ENTITY_KILL_HEIGHT) || (Distance2D(position, playerPosition) > ENTITY_DESPAWN_DISTANCE)) {
+            DespawnEntity(entities, entities->id[i]);
+        }
+    }
+
+    BuildSpatialHash(entities);
+    RunEntityPass(entities, world, deltaTime, SteerEntitiesJob, &pairsTested);
+    RunEntityPass(entities, world, deltaTime, MoveEntitiesJob, NULL);
+
+    entities->tick++;
+    entities->stats.entityCount = entities->count;
+    entities->stats.pairsTested = pairsTested;
+    entities->stats.updateTime = (float)((GetTime() - startTime)*1000.0);
+}
+
+int QueryEntitiesInRadius(const EntityWorld* entities, Vector3 center, float radius, int* results, int maxResults) {
+    int found = 0;
+    float radiusSqr = radius*radius;
+
+    int minX = GetCellCoord(center.x - radius), maxX = GetCellCoord(center.x + radius);
+    int minZ = GetCellCoord(center.z - radius), maxZ = GetCellCoord(center.z + radius);
+
+    for (int cellX = minX; cellX <= maxX; cellX++) {
+        for (int cellZ = minZ; cellZ <= maxZ; cellZ++) {
+            int bucket = GetCellBucket(cellX, cellZ);
+
+            for (int k = entities->bucketStart[bucket]; k < entities->bucketStart[bucket + 1]; k++) {
+                int index = entities->cellEntities[k];
+                Vector3 position = entities->position[index];
+
+                // Buckets are shared by colliding cells: only report entities of this cell, once
+                if ((GetCellCoord(position.x) != cellX) || (GetCellCoord(position.z) != cellZ)) continue;
+                if (Vector3DistanceSqr(position, center) > radiusSqr) continue;
+
+                results[found++] = index;
+                if (found >= maxResults) return found;
+            }
+        }
+    }
+
+    return found;
+}
+
+void SpawnEntitiesAround(EntityWorld* entities, Vector3 center, float radius, int count) {
+    for (int i = 0; i < count; i++) {
+        unsigned int seed = entities->tick*7919u + (unsigned int)i;
+        float angle = 2.0f*PI*EntityRandom(seed, entities->count, 5);
+        float distance = radius*sqrtf(EntityRandom(seed, entities->count, 6));
+        EntityType type = (EntityType)(int)(EntityRandom(seed, entities->count, 7)*ENTITY_TYPE_COUNT);
+
+        int x = (int)floorf(center.x + sinf(angle)*distance);
+        int z = (int)floorf(center.z + cosf(angle)*distance);
+        Vector3 position = { x + 0.5f, GetSurfaceLevel(x, z) + 1.0f, z + 0.5f };
+
+        if (SpawnEntity(entities, type, position) == ENTITY_INVALID_ID) break;
+    }
+}
+
+void RunEntityStressTest(EntityWorld* entities, Vector3 center) {
+    int before = entities->count;
+    SpawnEntitiesAround(entities, center, RENDER_DISTANCE*CHUNK_SIZE*0.5f, ENTITY_STRESS_COUNT);
+
+    printf("Entity stress test: spawned %d entities (%d alive), see HUD for tick cost\n",
+           entities->count - before, entities->count);
+}
+
+void BuildEntityRenderList(const EntityWorld* entities, float interpolation, EntityRenderList* list) {
+    if (!list->transforms) list->transforms = (Matrix*)malloc(MAX_ENTITIES*sizeof(Matrix));
+
+    memset(list->typeCount, 0, sizeof(list->typeCount));
+    for (int i = 0; i < entities->count; i++) list->typeCount[entities->type[i]]++;
+
+    int offset = 0;
+    int cursor[ENTITY_TYPE_COUNT];
+    for (int t = 0; t < ENTITY_TYPE_COUNT; t++) {
+        list->typeStart[t] = offset;
+        cursor[t] = offset;
+        offset += list->typeCount[t];
+    }
+
+    // Unit cube centered at the origin: scale to the type size, face the walking direction
+    for (int i = 0; i < entities->count; i++) {
+        const EntityTypeInfo* info = &entityTypes[entities->type[i]];
+        Vector3 position = Vector3Lerp(entities->previousPosition[i], entities->position[i], interpolation);
+
+        Matrix transform = MatrixMultiply(MatrixScale(info->width, info->height, info->width), MatrixRotateY(entities->yaw[i]));
+        transform = MatrixMultiply(transform, MatrixTranslate(position.x, position.y + info->height*0.5f, position.z));
+        list->transforms[cursor[entities->type[i]]++] = transform;
+    }
+
+    list->stats = entities->stats;
+}
+
+void UnloadEntityRenderList(EntityRenderList* list) {
+    free(list->transforms);
+    *list = (EntityRenderList){ 0 };
+}
@@ -0,0 +1,117 @@
+#ifndef ENTITY_SYSTEM_H
+#define ENTITY_SYSTEM_H
+
+#include "voxel_types.h"
+#include "voxel_world.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Entity Constants
+//----------------------------------------------------------------------------------
+#define MAX_ENTITIES            8192
+#define ENTITY_CELL_SIZE        4       // Spatial hash cell in blocks, divides CHUNK_SIZE so cells never straddle chunks
+#define ENTITY_HASH_BUCKETS     4096    // Power of two
+#define ENTITY_JOB_BATCH        256     // Entities per physics job
+#define ENTITY_DESPAWN_DISTANCE ((RENDER_DISTANCE + 1)*CHUNK_SIZE)
+#define ENTITY_STRESS_COUNT     2000    // Entities added by the stress test
+
+#define ENTITY_INVALID_ID       0
+
+typedef enum {
+    ENTITY_PIG = 0,
+    ENTITY_COW,
+    ENTITY_SHEEP,
+    ENTITY_CHICKEN,
+    ENTITY_TYPE_COUNT
+} EntityType;
+
+// Generational handle: slot in the low 16 bits, slot generation in the high 16 bits
+typedef unsigned int EntityId;
+
+// Per-type constants shared by simulation and rendering
+typedef struct {
+    const char* name;
+    const char* texture;        // Skin under resources/textures/entity
+    Rectangle face;             // Head front region of the skin, used on every cube face
+    float width;
+    float height;
+    float walkSpeed;
+} EntityTypeInfo;
+
+typedef struct {
+    int entityCount;
+    int pairsTested;            // Broadphase candidate pairs checked this tick
+    float updateTime;           // Milliseconds spent in the last UpdateEntities() call
+} EntityStats;
+
+//----------------------------------------------------------------------------------
+// Entity Storage (structure of arrays)
+// NOTE: Live entities are packed in [0, count), despawning moves the last one into the hole
+//----------------------------------------------------------------------------------
+typedef struct {
+    // Components, indexed by dense index
+    Vector3 position[MAX_ENTITIES];             // Feet center
+    Vector3 previousPosition[MAX_ENTITIES];     // Position at previous tick (render interpolation)
+    Vector3 velocity[MAX_ENTITIES];
+    float yaw[MAX_ENTITIES];
+    float wanderTimer[MAX_ENTITIES];            // Seconds until the next wander decision
+    bool walking[MAX_ENTITIES];
+    bool onGround[MAX_ENTITIES];
+    unsigned char type[MAX_ENTITIES];
+    EntityId id[MAX_ENTITIES];
+    int count;
+
+    // Handle table, indexed by slot
+    int denseIndex[MAX_ENTITIES];
+    unsigned short generation[MAX_ENTITIES];
+    int freeSlots[MAX_ENTITIES];
+    int freeCount;
+
+    // Spatial hash over ENTITY_CELL_SIZE columns, rebuilt every tick (counting sort)
+    int bucketStart[ENTITY_HASH_BUCKETS + 1];   // Range of each bucket in cellEntities
+    int cellEntities[MAX_ENTITIES];             // Dense indices grouped by bucket
+
+    unsigned int tick;
+    EntityStats stats;
+} EntityWorld;
+
+// Instance transforms of one frame, grouped by type (filled by the simulation thread)
+typedef struct {
+    Matrix* transforms;                         // MAX_ENTITIES entries, allocated on first use
+    int typeStart[ENTITY_TYPE_COUNT];
+    int typeCount[ENTITY_TYPE_COUNT];
+    EntityStats stats;
+} EntityRenderList;
+
+//----------------------------------------------------------------------------------
+// Entity Functions
+//----------------------------------------------------------------------------------
+void InitEntityWorld(EntityWorld* entities);
+const EntityTypeInfo* GetEntityTypeInfo(EntityType type);
+
+EntityId SpawnEntity(EntityWorld* entities, EntityType type, Vector3 position);    // ENTITY_INVALID_ID if full
+void DespawnEntity(EntityWorld* entities, EntityId id);
+int GetEntityIndex(const EntityWorld* entities, EntityId id);                       // Dense index, -1 if gone
+
+// Simulation tick: wander, separation, gravity and swept collision (batched over the job system)
+void UpdateEntities(EntityWorld* entities, VoxelWorld* world, Vector3 playerPosition, float deltaTime);
+
+// Neighbor query through the spatial hash, returns dense indices within radius of center
+int QueryEntitiesInRadius(const EntityWorld* entities, Vector3 center, float radius, int* results, int maxResults);
+
+// Spawning helpers
+void SpawnEntitiesAround(EntityWorld* entities, Vector3 center, float radius, int count);
+void RunEntityStressTest(EntityWorld* entities, Vector3 center);
+
+// Render snapshot
+void BuildEntityRenderList(const EntityWorld* entities, float interpolation, EntityRenderList* list);
+void UnloadEntityRenderList(EntityRenderList* list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ENTITY_SYSTEM_H
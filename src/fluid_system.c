@@ -0,0 +1,259 @@
+#include "fluid_system.h"
+#include "block_pos_set.h"
+#include "raylib.h"
+#include <stdlib.h>
+
+/*
+---------------------------------------------------------------------------------
+Fluid System
+
+Cellular water simulation driven by a scheduled update queue. Nothing scans loaded chunks:
+a cell is only looked at when something next to it changed, so still oceans cost nothing
+and only the active front of a flow does work.
+
+Water levels live in the chunk block data (0 = source, 1..FLUID_MAX_LEVEL = flowing, plus
+the FLUID_FALLING flag for columns fed from above). Each cell update:
+    1. Flowing cells re-derive their level from the cells feeding them (water above, or the
+       lowest horizontal neighbor + 1), and dry up when nothing feeds them anymore. Two
+       sources side by side over a solid floor create a new source.
+    2. The cell falls into the block below if it can, otherwise it spreads sideways one
+       level further, as long as the level stays under FLUID_MAX_LEVEL.
+Every change schedules the changed cell and its neighboring water FLUID_TICK_DELAY ticks
+later. The delay is constant, so the queue stays ordered by due tick as a plain FIFO; a
+hash set of queued positions (the active-cell set) keeps each cell queued at most once.
+
+At most FLUID_MAX_UPDATES_PER_TICK updates run per tick. A dam break that wakes more cells
+keeps the overflow at the front of the queue for the following ticks, so the cost per tick
+stays bounded while the flood advances a little slower.
+
+Edits go through SetBlockCached(), which only sets section dirty bits on the chunk: all the
+cells a tick changes in one 16x16x16 section end up in a single remesh of that section.
+Cells in chunks that are not generated behave as walls, water stops at the loaded border.
+
+---------------------------------------------------------------------------------
+*/
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct {
+    BlockPos position;
+    unsigned int dueTick;           // World tick the update runs at
+} FluidUpdate;
+
+// Growable ring buffer (FIFO)
+typedef struct {
+    FluidUpdate* updates;
+    int head;
+    int count;
+    int capacity;
+} FluidQueue;
+
+//----------------------------------------------------------------------------------
+// Local Variables
+//----------------------------------------------------------------------------------
+static FluidQueue queue = {0};
+static BlockPosSet activeCells = {0};    // Positions currently in the queue
+static unsigned int currentTick = 0;
+static FluidStats stats = {0};
+
+static const BlockPos horizontalOffsets[4] = { {-1, 0, 0}, {1, 0, 0}, {0, 0, -1}, {0, 0, 1} };
+static const BlockPos neighborOffsets[6] = { {-1, 0, 0}, {1, 0, 0}, {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1} };
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions
+//----------------------------------------------------------------------------------
+static void PushUpdate(FluidQueue* fifo, FluidUpdate update) {
+    if (fifo->count >= fifo->capacity) {
+        int newCapacity = (fifo->capacity > 0)? fifo->capacity*2 : 1024;
+        FluidUpdate* updates = (FluidUpdate*)malloc(newCapacity*sizeof(FluidUpdate));
+
+        // Unwrap the ring into the new storage
+        for (int i = 0; i < fifo->count; i++) updates[i] = fifo->updates[(fifo->head + i) % fifo->capacity];
+
+        free(fifo->updates);
+        fifo->updates = updates;
+        fifo->head = 0;
+        fifo->capacity = newCapacity;
+    }
+
+    fifo->updates[(fifo->head + fifo->count) % fifo->capacity] = update;
+    fifo->count++;
+}
+
+static FluidUpdate PopUpdate(FluidQueue* fifo) {
+    FluidUpdate update = fifo->updates[fifo->head];
+    fifo->head = (fifo->head + 1) % fifo->capacity;
+    fifo->count--;
+    return update;
+}
+
+// Block and data of a cell, space outside the generated world reads as a wall
+static BlockType ReadCell(VoxelWorld* world, BlockLookupCache* cache, int x, int y, int z, unsigned char* data) {
+    *data = 0;
+    if ((y < 0) || (y >= WORLD_HEIGHT)) return BLOCK_BEDROCK;
+
+    BlockType block = GetBlockCached(world, cache, x, y, z);
+    if (!cache->chunk) return BLOCK_BEDROCK;
+
+    *data = GetBlockDataCached(world, cache, x, y, z);
+    return block;
+}
+
+// Air and flowing water give way, sources and solid blocks do not
+static bool CanFlowInto(BlockType block, unsigned char data) {
+    return (block == BLOCK_AIR) || ((block == BLOCK_WATER) && (data != 0));
+}
+
+// Level a water cell spreads from, falling water spreads like a source
+static int GetSpreadLevel(unsigned char data) {
+    return (data & FLUID_FALLING)? 0 : (data & FLUID_LEVEL_MASK);
+}
+
+static void ScheduleCell(BlockPos position) {
+    if (!InsertBlockPos(&activeCells, position)) return;
+    PushUpdate(&queue, (FluidUpdate){ position, currentTick + FLUID_TICK_DELAY });
+}
+
+// Schedule a cell and the water next to it
+static void ScheduleAround(VoxelWorld* world, BlockLookupCache* cache, BlockPos position) {
+    unsigned char data;
+    if (ReadCell(world, cache, position.x, position.y, position.z, &data) == BLOCK_WATER) ScheduleCell(position);
+
+    for (int i = 0; i < 6; i++) {
+        BlockPos neighbor = { position.x + neighborOffsets[i].x, position.y + neighborOffsets[i].y,
+                              position.z + neighborOffsets[i].z };
+        if (ReadCell(world, cache, neighbor.x, neighbor.y, neighbor.z, &data) == BLOCK_WATER) ScheduleCell(neighbor);
+    }
+}
+
+// Block data a flowing cell should have given its feeders, -1 if nothing feeds it
+static int ComputeFlowingData(VoxelWorld* world, BlockLookupCache* cache, BlockPos position) {
+    unsigned char data;
+    if (ReadCell(world, cache, position.x, position.y + 1, position.z, &data) == BLOCK_WATER) return FLUID_FALLING;
+
+    int lowestLevel = FLUID_MAX_LEVEL + 1;
+    int sources = 0;
+    for (int i = 0; i < 4; i++) {
+        int x = position.x + horizontalOffsets[i].x;
+        int z = position.z + horizontalOffsets[i].z;
+        if (ReadCell(world, cache, x, position.y, z, &data) != BLOCK_WATER) continue;
+
+        if (data == 0) sources++;
+        int level = GetSpreadLevel(data);
+        if (level < lowestLevel) lowestLevel = level;
+    }
+
+    // Two sources over a floor fill the gap between them for good
+    if (sources >= 2) {
+        BlockType below = ReadCell(world, cache, position.x, position.y - 1, position.z, &data);
+        if (IsBlockSolid(below) || ((below == BLOCK_WATER) && (data == 0))) return 0;
+    }
+
+    return (lowestLevel + 1 <= FLUID_MAX_LEVEL)? lowestLevel + 1 : -1;
+}
+
+static void UpdateFluidCell(VoxelWorld* world, BlockLookupCache* cache, BlockPos position) {
+    unsigned char data;
+    if (ReadCell(world, cache, position.x, position.y, position.z, &data) != BLOCK_WATER) return;
+
+    // Flowing water follows its feeders, sources never change on their own
+    if (data != 0) {
+        int newData = ComputeFlowingData(world, cache, position);
+
+        if (newData != data) {
+            if (newData < 0) SetBlockCached(world, cache, position.x, position.y, position.z, BLOCK_AIR, 0);
+            else SetBlockCached(world, cache, position.x, position.y, position.z, BLOCK_WATER, (unsigned char)newData);
+
+            ScheduleAround(world, cache, position);
+            if (newData < 0) return;
+            data = (unsigned char)newData;
+        }
+    }
+
+    // Fall first, spread sideways only when resting on something
+    unsigned char belowData;
+    BlockType below = ReadCell(world, cache, position.x, position.y - 1, position.z, &belowData);
+    if (CanFlowInto(below, belowData)) {
+        if ((below != BLOCK_WATER) || (belowData != FLUID_FALLING)) {
+            SetBlockCached(world, cache, position.x, position.y - 1, position.z, BLOCK_WATER, FLUID_FALLING);
+            ScheduleCell((BlockPos){ position.x, position.y - 1, position.z });
+        }
+        return;
+    }
+
+    int level = GetSpreadLevel(data) + 1;
+    if (level > FLUID_MAX_LEVEL) return;
+
+    for (int i = 0; i < 4; i++) {
+        BlockPos neighbor = { position.x + horizontalOffsets[i].x, position.y, position.z + horizontalOffsets[i].z };
+
+        unsigned char neighborData;
+        BlockType block = ReadCell(world, cache, neighbor.x, neighbor.y, neighbor.z, &neighborData);
+
+        // Only raise water, never lower a cell another feeder keeps higher
+        bool spread = (block == BLOCK_AIR) ||
+                      ((block == BLOCK_WATER) && (neighborData != 0) && !(neighborData & FLUID_FALLING) &&
+                       ((neighborData & FLUID_LEVEL_MASK) > level));
+
+        if (spread) {
+            SetBlockCached(world, cache, neighbor.x, neighbor.y, neighbor.z, BLOCK_WATER, (unsigned char)level);
+            ScheduleCell(neighbor);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Fluid Functions
+//----------------------------------------------------------------------------------
+void InitFluidSystem(void) {
+    queue.head = 0;
+    queue.count = 0;
+    ClearBlockPosSet(&activeCells);
+    stats = (FluidStats){0};
+}
+
+void UnloadFluidSystem(void) {
+    free(queue.updates);
+    UnloadBlockPosSet(&activeCells);
+    queue = (FluidQueue){0};
+    stats = (FluidStats){0};
+}
+
+void UpdateFluids(VoxelWorld* world) {
+    double startTime = GetTime();
+    currentTick = world->tickCount;
+
+    BlockLookupCache cache = { 0 };
+    int processed = 0;
+
+    while ((queue.count > 0) && (processed < FLUID_MAX_UPDATES_PER_TICK)) {
+        // Wrap-safe comparison, the queue front is always the earliest due update
+        if ((int)(queue.updates[queue.head].dueTick - currentTick) > 0) break;
+
+        FluidUpdate update = PopUpdate(&queue);
+        RemoveBlockPos(&activeCells, update.position);
+        UpdateFluidCell(world, &cache, update.position);
+        processed++;
+    }
+
+    // Due updates left behind by the cap run first next tick
+    int deferred = 0;
+    while ((deferred < queue.count) &&
+           ((int)(queue.updates[(queue.head + deferred) % queue.capacity].dueTick - currentTick) <= 0)) deferred++;
+
+    stats.activeCells = queue.count;
+    stats.updatesProcessed = processed;
+    stats.updatesDeferred = deferred;
+    stats.updateTime = (float)((GetTime() - startTime)*1000.0);
+}
+
+void NotifyFluidNeighbors(VoxelWorld* world, BlockPos position) {
+    BlockLookupCache cache = { 0 };
+    currentTick = world->tickCount;
+    ScheduleAround(world, &cache, position);
+}
+
+FluidStats GetFluidStats(void) {
+    return stats;
+}
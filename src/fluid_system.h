@@ -0,0 +1,49 @@
+#ifndef FLUID_SYSTEM_H
+#define FLUID_SYSTEM_H
+
+#include "voxel_types.h"
+#include "voxel_world.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Fluid Constants
+//----------------------------------------------------------------------------------
+#define FLUID_TICK_DELAY            12      // Simulation ticks between a change and the neighbor reaction (5 Hz)
+#define FLUID_MAX_UPDATES_PER_TICK  2048    // Cell updates per tick, the rest waits for the next tick
+#define FLUID_MAX_LEVEL             7       // Flowing water stops spreading past this level
+
+// Water block data: level in the low bits (0 = source, 1..7 = flowing), plus the falling flag
+#define FLUID_LEVEL_MASK            0x07
+#define FLUID_FALLING               0x08    // Fed from above, behaves as level 0 when spreading
+
+typedef struct {
+    int activeCells;                // Cells waiting in the update queue
+    int updatesProcessed;           // Cell updates run in the last tick
+    int updatesDeferred;            // Due updates pushed to the next tick by the per-tick cap
+    float updateTime;               // Milliseconds spent in the last UpdateFluids() call
+} FluidStats;
+
+//----------------------------------------------------------------------------------
+// Fluid Functions (simulation thread)
+//----------------------------------------------------------------------------------
+void InitFluidSystem(void);                                             // Also drops pending updates
+void UnloadFluidSystem(void);
+void UpdateFluids(VoxelWorld* world);                                   // Called once per simulation tick
+void NotifyFluidNeighbors(VoxelWorld* world, BlockPos position);      // A block changed, wake the fluid around it
+FluidStats GetFluidStats(void);
+
+// Surface height of a water cell (0..1) from its block data, full when water sits on top
+static inline float GetFluidHeight(unsigned char data, bool fluidAbove)
+{
+    if (fluidAbove || (data & FLUID_FALLING)) return 1.0f;
+    return (float)(FLUID_MAX_LEVEL + 1 - (data & FLUID_LEVEL_MASK))/(FLUID_MAX_LEVEL + 2);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FLUID_SYSTEM_H
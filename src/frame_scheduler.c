@@ -0,0 +1,159 @@
+#include "frame_scheduler.h"
+#include "raylib.h"
+#include <stdlib.h>
+
+/*
+---------------------------------------------------------------------------------
+Frame Scheduler
+
+Time-sliced queue for work that must run on the main (GL) thread: chunk mesh uploads,
+mesh releases and similar. Tasks are queued per priority and executed highest priority
+first, in submission order, until the configured slice of the frame is used; whatever
+is left waits for the next frame. At least one task runs every frame, so progress is
+guaranteed even if a single task exceeds the budget.
+
+Tasks waiting longer than FRAME_TASK_STARVATION_FRAMES are promoted one priority level
+so a steady stream of high priority work can not starve lower priorities forever.
+
+---------------------------------------------------------------------------------
+*/
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct {
+    FrameTaskFunc func;
+    void* userData;
+    int queuedFrame;            // Frame the task entered its current queue
+} FrameTask;
+
+// Growable ring buffer (FIFO)
+typedef struct {
+    FrameTask* tasks;
+    int head;
+    int count;
+    int capacity;
+} FrameTaskQueue;
+
+//----------------------------------------------------------------------------------
+// Local Variables
+//----------------------------------------------------------------------------------
+static FrameTaskQueue queues[FRAME_TASK_PRIORITY_COUNT] = {0};
+static float budgetMs = FRAME_TASK_BUDGET_MS;
+static int frameIndex = 0;
+static FrameTaskStats lastStats = {0};
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions
+//----------------------------------------------------------------------------------
+static void PushTask(FrameTaskQueue* queue, FrameTask task) {
+    if (queue->count >= queue->capacity) {
+        int newCapacity = (queue->capacity > 0)? queue->capacity*2 : 256;
+        FrameTask* tasks = (FrameTask*)malloc(newCapacity*sizeof(FrameTask));
+
+        // Unwrap the ring into the new storage
+        for (int i = 0; i < queue->count; i++) tasks[i] = queue->tasks[(queue->head + i) % queue->capacity];
+
+        free(queue->tasks);
+        queue->tasks = tasks;
+        queue->head = 0;
+        queue->capacity = newCapacity;
+    }
+
+    queue->tasks[(queue->head + queue->count) % queue->capacity] = task;
+    queue->count++;
+}
+
+static FrameTask PopTask(FrameTaskQueue* queue) {
+    FrameTask task = queue->tasks[queue->head];
+    queue->head = (queue->head + 1) % queue->capacity;
+    queue->count--;
+    return task;
+}
+
+// Promote tasks that waited too long, oldest tasks sit at the front of each queue
+static int PromoteStarvedTasks(void) {
+    int promoted = 0;
+
+    for (int priority = 1; priority < FRAME_TASK_PRIORITY_COUNT; priority++) {
+        FrameTaskQueue* queue = &queues[priority];
+
+        while ((queue->count > 0) &&
+               (frameIndex - queue->tasks[queue->head].queuedFrame > FRAME_TASK_STARVATION_FRAMES)) {
+            FrameTask task = PopTask(queue);
+            task.queuedFrame = frameIndex;
+            PushTask(&queues[priority - 1], task);
+            promoted++;
+        }
+    }
+
+    return promoted;
+}
+
+static int GetPendingTaskCount(void) {
+    int count = 0;
+    for (int i = 0; i < FRAME_TASK_PRIORITY_COUNT; i++) count += queues[i].count;
+    return count;
+}
+
+//----------------------------------------------------------------------------------
+// Frame Scheduler Functions
+//----------------------------------------------------------------------------------
+void SetFrameTaskBudget(float milliseconds) {
+    budgetMs = (milliseconds > 0.0f)? milliseconds : 0.0f;
+}
+
+void ScheduleFrameTask(FrameTaskPriority priority, FrameTaskFunc func, void* userData) {
+    FrameTask task = { func, userData, frameIndex };
+    PushTask(&queues[priority], task);
+}
+
+void RunFrameTasks(void) {
+    FrameTaskStats stats = {0};
+    stats.budget = budgetMs;
+    stats.tasksStarved = PromoteStarvedTasks();
+
+    double startTime = GetTime();
+    double budgetSeconds = budgetMs/1000.0;
+
+    for (int priority = 0; priority < FRAME_TASK_PRIORITY_COUNT; priority++) {
+        FrameTaskQueue* queue = &queues[priority];
+
+        while (queue->count > 0) {
+            // Always make progress: the first task of a frame runs even with no budget
+            if ((stats.tasksRun > 0) && (GetTime() - startTime >= budgetSeconds)) break;
+
+            FrameTask task = PopTask(queue);
+            task.func(task.userData);
+            stats.tasksRun++;
+        }
+    }
+
+    stats.timeUsed = (float)((GetTime() - startTime)*1000.0);
+    stats.tasksDeferred = GetPendingTaskCount();
+    lastStats = stats;
+
+    frameIndex++;
+}
+
+void FlushFrameTasks(void) {
+    for (int priority = 0; priority < FRAME_TASK_PRIORITY_COUNT; priority++) {
+        while (queues[priority].count > 0) {
+            FrameTask task = PopTask(&queues[priority]);
+            task.func(task.userData);
+        }
+    }
+}
+
+void UnloadFrameScheduler(void) {
+    FlushFrameTasks();
+
+    for (int i = 0; i < FRAME_TASK_PRIORITY_COUNT; i++) {
+        free(queues[i].tasks);
+        queues[i] = (FrameTaskQueue){0};
+    }
+}
+
+FrameTaskStats GetFrameTaskStats(void) {
+    return lastStats;
+}
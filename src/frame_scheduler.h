@@ -0,0 +1,48 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Frame Scheduler Constants
+//----------------------------------------------------------------------------------
+#define FRAME_TASK_BUDGET_MS            3.0f    // Default main-thread slice per frame
+#define FRAME_TASK_STARVATION_FRAMES    30      // Frames a task may wait before being promoted
+
+typedef enum {
+    FRAME_TASK_HIGH = 0,        // Needed for the current frame to look right
+    FRAME_TASK_NORMAL,          // Chunk uploads and releases
+    FRAME_TASK_LOW,             // Cosmetic or speculative work
+    FRAME_TASK_PRIORITY_COUNT
+} FrameTaskPriority;
+
+// Main-thread task, runs once (tasks of the same priority run in submission order)
+typedef void (*FrameTaskFunc)(void* userData);
+
+typedef struct {
+    int tasksRun;               // Tasks executed this frame
+    int tasksDeferred;          // Tasks left for later frames because the budget ran out
+    int tasksStarved;           // Tasks promoted this frame after waiting too long
+    float timeUsed;             // Milliseconds spent running tasks this frame
+    float budget;               // Milliseconds allowed per frame
+} FrameTaskStats;
+
+//----------------------------------------------------------------------------------
+// Frame Scheduler Functions (main thread only)
+//----------------------------------------------------------------------------------
+void SetFrameTaskBudget(float milliseconds);
+void ScheduleFrameTask(FrameTaskPriority priority, FrameTaskFunc func, void* userData);
+void RunFrameTasks(void);                   // Run queued tasks until the frame budget is used
+void FlushFrameTasks(void);                 // Run every queued task, ignoring the budget
+void UnloadFrameScheduler(void);
+FrameTaskStats GetFrameTaskStats(void);     // Counters of the last RunFrameTasks() call
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FRAME_SCHEDULER_H
@@ -0,0 +1,412 @@
+#include "job_system.h"
+#include "platform_threads.h"
+#include "raylib.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+/*
+---------------------------------------------------------------------------------
+Job System
+
+Fixed pool of worker threads shared by every asynchronous engine task (terrain
+generation, chunk meshing...). Each worker owns a queue: it pushes and pops its own
+jobs at the back (LIFO, cache-warm) while idle workers steal from the front of other
+queues (FIFO, oldest and usually largest work first). Threads that are not workers
+(main and simulation threads) submit into a shared injection queue.
+
+Completion is tracked with JobCounter: a batch of jobs decrements its counter as jobs
+finish and continuations parked on the counter are submitted when it reaches zero.
+WaitForCounter() never blocks idle, the waiting thread executes queued jobs until the
+counter drains. Without thread support jobs simply execute inline on submission.
+
+---------------------------------------------------------------------------------
+*/
+
+//----------------------------------------------------------------------------------
+// Local Constants and Macros
+//----------------------------------------------------------------------------------
+#define MAX_JOB_WORKERS 32
+
+#define JOB_BENCHMARK_CHAINS        256     // Dependent chains run by the benchmark
+#define JOB_BENCHMARK_STAGES        3       // Stages per chain (generate, light, mesh)
+#define JOB_BENCHMARK_STAGE_JOBS    4       // Jobs per stage, fits the continuation list of a counter
+
+#if defined(_MSC_VER)
+    #define THREAD_LOCAL __declspec(thread)
+#else
+    #define THREAD_LOCAL __thread
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct {
+    JobDecl job;
+    JobCounter* counter;
+} QueuedJob;
+
+// Ring buffer, owner works at the back and thieves take from the front
+typedef struct {
+    Mutex* mutex;
+    QueuedJob* jobs;
+    int head;
+    int count;
+} JobQueue;
+
+// Benchmark chain stage, shared by the jobs of the stage
+typedef struct {
+    JobCounter* dependency;     // Counter of the previous stage, NULL for the first one
+    volatile int* runs;
+    volatile int* orderErrors;  // Jobs that started before their dependency was done
+} ChainStage;
+
+//----------------------------------------------------------------------------------
+// Local Variables
+//----------------------------------------------------------------------------------
+static Thread* workers[MAX_JOB_WORKERS] = {0};
+static JobQueue queues[MAX_JOB_WORKERS + 1] = {0};  // Last queue receives external submissions
+static int workerCount = 0;
+static bool jobSystemReady = false;
+
+static Mutex* sleepMutex = NULL;
+static CondVar* sleepCondVar = NULL;
+static volatile int queuedJobCount = 0;
+static volatile int quitWorkers = 0;
+
+static THREAD_LOCAL int currentWorker = -1;         // Worker index of calling thread, -1 if external
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions
+//----------------------------------------------------------------------------------
+static void LockCounter(JobCounter* counter) {
+    while (!AtomicCompareExchange(&counter->lock, 0, 1)) YieldThread();
+}
+
+static void UnlockCounter(JobCounter* counter) {
+    AtomicStore(&counter->lock, 0);
+}
+
+static void PushJob(JobDecl job, JobCounter* counter);
+
+// Decrement the counter of a finished job and release its continuations
+// NOTE: Decrement happens under the counter lock, WaitForCounter() relies on it
+static void FinishJob(JobCounter* counter) {
+    if (!counter) return;
+
+    JobDecl ready[MAX_JOB_CONTINUATIONS];
+    JobCounter* readyCounters[MAX_JOB_CONTINUATIONS];
+    int readyCount = 0;
+
+    LockCounter(counter);
+    if (AtomicAdd(&counter->value, -1) == 0) {
+        readyCount = counter->continuationCount;
+        for (int i = 0; i < readyCount; i++) {
+            ready[i] = counter->continuations[i];
+            readyCounters[i] = counter->continuationCounters[i];
+        }
+        counter->continuationCount = 0;
+    }
+    UnlockCounter(counter);
+
+    for (int i = 0; i < readyCount; i++) PushJob(ready[i], readyCounters[i]);
+}
+
+static void ExecuteJob(QueuedJob* queued) {
+    queued->job.func(queued->job.userData);
+    FinishJob(queued->counter);
+}
+
+static bool PopJobBack(JobQueue* queue, QueuedJob* job) {
+    bool found = false;
+    LockMutex(queue->mutex);
+    if (queue->count > 0) {
+        queue->count--;
+        *job = queue->jobs[(queue->head + queue->count) % JOB_QUEUE_CAPACITY];
+        found = true;
+    }
+    UnlockMutex(queue->mutex);
+    return found;
+}
+
+static bool PopJobFront(JobQueue* queue, QueuedJob* job) {
+    bool found = false;
+    LockMutex(queue->mutex);
+    if (queue->count > 0) {
+        *job = queue->jobs[queue->head];
+        queue->head = (queue->head + 1) % JOB_QUEUE_CAPACITY;
+        queue->count--;
+        found = true;
+    }
+    UnlockMutex(queue->mutex);
+    return found;
+}
+
+static void PushJob(JobDecl job, JobCounter* counter) {
+    QueuedJob queued = { job, counter };
+
+    if (!jobSystemReady || (workerCount == 0)) {
+        ExecuteJob(&queued);
+        return;
+    }
+
+    JobQueue* queue = (currentWorker >= 0)? &queues[currentWorker] : &queues[workerCount];
+
+    // NOTE: Counter is raised before the job is published, so a worker that pops it can never
+    // take the count below zero; a worker checking it under the sleep lock either sees the new
+    // job or is already waiting and receives the signal
+    AtomicAdd(&queuedJobCount, 1);
+
+    LockMutex(queue->mutex);
+    bool pushed = (queue->count < JOB_QUEUE_CAPACITY);
+    if (pushed) {
+        queue->jobs[(queue->head + queue->count) % JOB_QUEUE_CAPACITY] = queued;
+        queue->count++;
+    }
+    UnlockMutex(queue->mutex);
+
+    if (!pushed) {
+        // Queue full: run on the submitting thread rather than dropping work
+        AtomicAdd(&queuedJobCount, -1);
+        ExecuteJob(&queued);
+        return;
+    }
+
+    LockMutex(sleepMutex);
+    SignalCondVar(sleepCondVar);
+    UnlockMutex(sleepMutex);
+}
+
+// Find a job: own queue first, then external submissions, then steal from other workers
+static bool TryRunJob(void) {
+    if (AtomicLoad(&queuedJobCount) == 0) return false;
+
+    QueuedJob job;
+    bool found = false;
+
+    if (currentWorker >= 0) found = PopJobBack(&queues[currentWorker], &job);
+    if (!found) found = PopJobFront(&queues[workerCount], &job);
+
+    for (int i = 1; !found && (i <= workerCount); i++) {
+        int victim = (currentWorker + i + workerCount) % workerCount;
+        if (victim == currentWorker) continue;
+        found = PopJobFront(&queues[victim], &job);
+    }
+
+    if (!found) return false;
+
+    AtomicAdd(&queuedJobCount, -1);
+    ExecuteJob(&job);
+    return true;
+}
+
+static void WorkerThread(void* userData) {
+    currentWorker = (int)(size_t)userData;
+
+    while (!AtomicLoad(&quitWorkers)) {
+        if (TryRunJob()) continue;
+
+        LockMutex(sleepMutex);
+        while ((AtomicLoad(&queuedJobCount) == 0) && !AtomicLoad(&quitWorkers)) {
+            WaitCondVar(sleepCondVar, sleepMutex);
+        }
+        UnlockMutex(sleepMutex);
+    }
+}
+
+static void EmptyJob(void* userData) {
+    (void)userData;
+}
+
+static void ChainStageJob(void* userData) {
+    ChainStage* stage = (ChainStage*)userData;
+    if (stage->dependency && !IsCounterDone(stage->dependency)) AtomicAdd(stage->orderErrors, 1);
+    AtomicAdd(stage->runs, 1);
+}
+
+//----------------------------------------------------------------------------------
+// Job System Functions
+//----------------------------------------------------------------------------------
+void InitJobSystem(int requestedWorkers) {
+    if (jobSystemReady) return;
+
+    int count = (requestedWorkers > 0)? requestedWorkers : GetCpuCoreCount() - 1;
+    if (count < 1) count = 1;
+    if (count > MAX_JOB_WORKERS) count = MAX_JOB_WORKERS;
+
+    sleepMutex = LoadMutex();
+    sleepCondVar = LoadCondVar();
+    AtomicStore(&queuedJobCount, 0);
+    AtomicStore(&quitWorkers, 0);
+
+    for (int i = 0; i <= count; i++) {
+        queues[i].mutex = LoadMutex();
+        queues[i].jobs = (QueuedJob*)malloc(JOB_QUEUE_CAPACITY*sizeof(QueuedJob));
+        queues[i].head = 0;
+        queues[i].count = 0;
+    }
+
+    // NOTE: workerCount must be final before any worker starts looking for jobs
+    workerCount = count;
+    jobSystemReady = true;
+
+    int started = 0;
+    for (int i = 0; i < count; i++) {
+        workers[i] = StartThread(WorkerThread, (void*)(size_t)i);
+        if (workers[i]) started++;
+    }
+
+    if (started < count) {
+        // No (or partial) thread support: stop what started and fall back to inline execution
+        UnloadJobSystem();
+        jobSystemReady = true;
+        workerCount = 0;
+        printf("Job system: threads unavailable, running jobs inline\n");
+        return;
+    }
+
+    printf("Job system: %d worker threads\n", workerCount);
+}
+
+void UnloadJobSystem(void) {
+    if (!jobSystemReady) return;
+
+    if (sleepMutex) {
+        LockMutex(sleepMutex);
+        AtomicStore(&quitWorkers, 1);
+        BroadcastCondVar(sleepCondVar);
+        UnlockMutex(sleepMutex);
+    }
+
+    for (int i = 0; i < MAX_JOB_WORKERS; i++) {
+        if (workers[i]) JoinThread(workers[i]);
+        workers[i] = NULL;
+    }
+
+    for (int i = 0; i <= MAX_JOB_WORKERS; i++) {
+        if (queues[i].mutex) UnloadMutex(queues[i].mutex);
+        free(queues[i].jobs);
+        queues[i] = (JobQueue){0};
+    }
+
+    UnloadCondVar(sleepCondVar);
+    UnloadMutex(sleepMutex);
+    sleepCondVar = NULL;
+    sleepMutex = NULL;
+
+    workerCount = 0;
+    jobSystemReady = false;
+}
+
+int GetJobWorkerCount(void) {
+    return workerCount;
+}
+
+int GetQueuedJobCount(void) {
+    return AtomicLoad(&queuedJobCount);
+}
+
+void RunJobs(const JobDecl* jobs, int count, JobCounter* counter) {
+    if (counter) AtomicAdd(&counter->value, count);
+    for (int i = 0; i < count; i++) PushJob(jobs[i], counter);
+}
+
+void RunJobsAfter(JobCounter* dependency, const JobDecl* jobs, int count, JobCounter* counter) {
+    if (counter) AtomicAdd(&counter->value, count);
+
+    LockCounter(dependency);
+    bool parked = false;
+    if ((AtomicLoad(&dependency->value) > 0) &&
+        (dependency->continuationCount + count <= MAX_JOB_CONTINUATIONS)) {
+        for (int i = 0; i < count; i++) {
+            dependency->continuations[dependency->continuationCount] = jobs[i];
+            dependency->continuationCounters[dependency->continuationCount] = counter;
+            dependency->continuationCount++;
+        }
+        parked = true;
+    }
+    UnlockCounter(dependency);
+
+    if (parked) return;
+
+    // Dependency already done, or no room left to park: wait (helping) and submit now
+    WaitForCounter(dependency);
+    for (int i = 0; i < count; i++) PushJob(jobs[i], counter);
+}
+
+void WaitForCounter(JobCounter* counter) {
+    while (AtomicLoad(&counter->value) > 0) {
+        if (!TryRunJob()) YieldThread();
+    }
+
+    // Make sure the thread that finished the last job released the counter,
+    // callers usually free it (or let it go out of scope) right after this returns
+    LockCounter(counter);
+    UnlockCounter(counter);
+}
+
+bool IsCounterDone(JobCounter* counter) {
+    return (AtomicLoad(&counter->value) == 0);
+}
+
+//----------------------------------------------------------------------------------
+// Job System Benchmark
+//----------------------------------------------------------------------------------
+double RunJobSystemBenchmark(int jobCount) {
+    JobDecl batch[256];
+    const int batchSize = sizeof(batch)/sizeof(batch[0]);
+    for (int i = 0; i < batchSize; i++) batch[i] = (JobDecl){ EmptyJob, NULL };
+
+    JobCounter counter = {0};
+    double startTime = GetTime();
+
+    for (int submitted = 0; submitted < jobCount; submitted += batchSize) {
+        int count = (jobCount - submitted < batchSize)? jobCount - submitted : batchSize;
+        RunJobs(batch, count, &counter);
+    }
+    WaitForCounter(&counter);
+
+    double elapsed = GetTime() - startTime;
+    double throughput = (elapsed > 0.0)? jobCount/elapsed : 0.0;
+
+    printf("Job system benchmark: %d jobs on %d workers in %.2f ms (%.0f jobs/s)\n",
+           jobCount, workerCount, elapsed*1000.0, throughput);
+
+    // Dependent chains shaped like generate -> light -> mesh, every stage parked on the counter of the previous one
+    const int stageCount = JOB_BENCHMARK_CHAINS*JOB_BENCHMARK_STAGES;
+    JobCounter* counters = (JobCounter*)calloc(stageCount, sizeof(JobCounter));
+    ChainStage* stages = (ChainStage*)calloc(stageCount, sizeof(ChainStage));
+    volatile int runs = 0;
+    volatile int orderErrors = 0;
+
+    startTime = GetTime();
+    for (int chain = 0; chain < JOB_BENCHMARK_CHAINS; chain++) {
+        for (int s = 0; s < JOB_BENCHMARK_STAGES; s++) {
+            int index = chain*JOB_BENCHMARK_STAGES + s;
+            JobCounter* dependency = (s > 0)? &counters[index - 1] : NULL;
+            stages[index] = (ChainStage){ dependency, &runs, &orderErrors };
+
+            JobDecl stageJobs[JOB_BENCHMARK_STAGE_JOBS];
+            for (int i = 0; i < JOB_BENCHMARK_STAGE_JOBS; i++) stageJobs[i] = (JobDecl){ ChainStageJob, &stages[index] };
+
+            if (dependency) RunJobsAfter(dependency, stageJobs, JOB_BENCHMARK_STAGE_JOBS, &counters[index]);
+            else RunJobs(stageJobs, JOB_BENCHMARK_STAGE_JOBS, &counters[index]);
+        }
+    }
+
+    // The last stage only starts once the earlier ones drained, waiting on it covers the chain
+    for (int chain = 0; chain < JOB_BENCHMARK_CHAINS; chain++) {
+        WaitForCounter(&counters[chain*JOB_BENCHMARK_STAGES + JOB_BENCHMARK_STAGES - 1]);
+    }
+    double chainTime = GetTime() - startTime;
+
+    bool chainsValid = (AtomicLoad(&runs) == stageCount*JOB_BENCHMARK_STAGE_JOBS) && (AtomicLoad(&orderErrors) == 0);
+    for (int i = 0; i < stageCount; i++) {
+        if (!IsCounterDone(&counters[i]) || (counters[i].continuationCount != 0)) chainsValid = false;
+    }
+    free(counters);
+    free(stages);
+
+    printf("Job system benchmark: %d chains of %d stages in %.2f ms (%s)\n", JOB_BENCHMARK_CHAINS, JOB_BENCHMARK_STAGES,
+           chainTime*1000.0, chainsValid? "dependencies respected" : "DEPENDENCY VIOLATED");
+    return throughput;
+}
@@ -0,0 +1,62 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Job System Constants
+//----------------------------------------------------------------------------------
+#define JOB_QUEUE_CAPACITY      4096    // Jobs per worker queue (full queues run jobs inline)
+#define MAX_JOB_CONTINUATIONS   8       // Continuations that can wait on a single counter
+
+//----------------------------------------------------------------------------------
+// Job Types
+// NOTE: Jobs are copied by value into the queues, completion is tracked by counters
+//----------------------------------------------------------------------------------
+typedef void (*JobFunc)(void* userData);
+
+typedef struct {
+    JobFunc func;
+    void* userData;
+} JobDecl;
+
+// Completion counter shared by a batch of jobs, must outlive the jobs it tracks
+typedef struct JobCounter {
+    volatile int value;                                     // Jobs of this batch not finished yet
+    volatile int lock;                                      // Guards the continuation list
+    int continuationCount;
+    JobDecl continuations[MAX_JOB_CONTINUATIONS];           // Jobs started when value reaches zero
+    struct JobCounter* continuationCounters[MAX_JOB_CONTINUATIONS];
+} JobCounter;
+
+//----------------------------------------------------------------------------------
+// Job System Functions
+//----------------------------------------------------------------------------------
+void InitJobSystem(int workerCount);        // workerCount <= 0: one worker per core, minus the main thread
+void UnloadJobSystem(void);
+int GetJobWorkerCount(void);                // 0 when jobs run inline (no thread support)
+int GetQueuedJobCount(void);
+
+// Submit a batch, counter (optional) is incremented by count and decremented as jobs finish
+void RunJobs(const JobDecl* jobs, int count, JobCounter* counter);
+
+// Submit a batch once every job tracked by dependency has finished (continuation)
+void RunJobsAfter(JobCounter* dependency, const JobDecl* jobs, int count, JobCounter* counter);
+
+// Block until counter reaches zero, executing queued jobs meanwhile (help while waiting)
+void WaitForCounter(JobCounter* counter);
+bool IsCounterDone(JobCounter* counter);
+
+// Microbenchmark: run jobCount empty jobs, returns throughput in jobs per second
+// NOTE: Also runs dependent job chains and reports whether every continuation waited for its dependency
+double RunJobSystemBenchmark(int jobCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // JOB_SYSTEM_H
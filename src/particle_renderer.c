@@ -0,0 +1,144 @@
+#include "particle_renderer.h"
+#include "voxel_renderer.h"
+#include "render_stats.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <stdio.h>
+
+/*
+---------------------------------------------------------------------------------
+Particle Renderer
+
+Draws every live particle with a single instanced draw call: one unit quad, expanded
+into a camera facing billboard in the vertex shader from the per-instance data packed
+by BuildParticleRenderList(). Debris samples the block atlas and ambient effects the
+particle sheet, both bound at once so texture changes never split the batch.
+
+Without the instancing shader particles are not drawn (they are purely cosmetic).
+
+---------------------------------------------------------------------------------
+*/
+
+//----------------------------------------------------------------------------------
+// Local Constants and Macros
+//----------------------------------------------------------------------------------
+#if defined(PLATFORM_WEB)
+    #define GLSL_VERSION 100
+#else
+    #define GLSL_VERSION 330
+#endif
+
+//----------------------------------------------------------------------------------
+// Local Variables
+//----------------------------------------------------------------------------------
+static Mesh quadMesh = { 0 };
+static Shader particleShader = { 0 };
+static Material particleMaterial = { 0 };
+static Texture2D particleSheet = { 0 };
+static int cameraRightLoc = -1;
+static int cameraUpLoc = -1;
+static bool particleRendererReady = false;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions
+//----------------------------------------------------------------------------------
+// Unit quad centered at the origin in the XY plane, billboarded by the shader
+static Mesh GenParticleQuad(void) {
+    Mesh mesh = { 0 };
+    mesh.vertexCount = 4;
+    mesh.triangleCount = 2;
+    mesh.vertices = (float*)RL_MALLOC(4*3*sizeof(float));
+    mesh.texcoords = (float*)RL_MALLOC(4*2*sizeof(float));
+    mesh.indices = (unsigned short*)RL_MALLOC(6*sizeof(unsigned short));
+
+    const float corners[4][2] = { { -0.5f, -0.5f }, { 0.5f, -0.5f }, { 0.5f, 0.5f }, { -0.5f, 0.5f } };
+    for (int i = 0; i < 4; i++) {
+        mesh.vertices[i*3 + 0] = corners[i][0];
+        mesh.vertices[i*3 + 1] = corners[i][1];
+        mesh.vertices[i*3 + 2] = 0.0f;
+        mesh.texcoords[i*2 + 0] = corners[i][0] + 0.5f;
+        mesh.texcoords[i*2 + 1] = 0.5f - corners[i][1];     // Image rows go down
+    }
+
+    const unsigned short indices[6] = { 0, 1, 2, 0, 2, 3 };
+    for (int i = 0; i < 6; i++) mesh.indices[i] = indices[i];
+
+    UploadMesh(&mesh, false);
+    return mesh;
+}
+
+//----------------------------------------------------------------------------------
+// Particle Rendering Functions
+//----------------------------------------------------------------------------------
+void InitParticleRenderer(void) {
+    if (particleRendererReady) return;
+
+    char vsPath[256];
+    char fsPath[256];
+    bool shaderFound = FindResourcePath(TextFormat("shaders/glsl%i/particle_instanced.vs", GLSL_VERSION), vsPath, sizeof(vsPath)) &&
+                       FindResourcePath(TextFormat("shaders/glsl%i/particle_instanced.fs", GLSL_VERSION), fsPath, sizeof(fsPath));
+    if (!shaderFound) {
+        printf("Particle renderer: instancing shader not found, particles disabled\n");
+        return;
+    }
+
+    particleShader = LoadShader(vsPath, fsPath);
+    if (particleShader.id == rlGetShaderIdDefault()) {
+        printf("Particle renderer: instancing shader failed to compile, particles disabled\n");
+        return;
+    }
+
+    particleShader.locs[SHADER_LOC_MATRIX_MVP] = GetShaderLocation(particleShader, "mvp");
+    particleShader.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(particleShader, "instanceTransform");
+    cameraRightLoc = GetShaderLocation(particleShader, "cameraRight");
+    cameraUpLoc = GetShaderLocation(particleShader, "cameraUp");
+
+    char sheetPath[256];
+    if (FindResourcePath("textures/particle/particles.png", sheetPath, sizeof(sheetPath))) particleSheet = LoadTexture(sheetPath);
+    else {
+        Image placeholder = GenImageColor(16, 16, WHITE);
+        particleSheet = LoadTextureFromImage(placeholder);
+        UnloadImage(placeholder);
+    }
+    SetTextureFilter(particleSheet, TEXTURE_FILTER_POINT);
+
+    quadMesh = GenParticleQuad();
+    particleMaterial = LoadMaterialDefault();
+    particleMaterial.shader = particleShader;
+    particleMaterial.maps[MATERIAL_MAP_METALNESS].texture = particleSheet;     // Bound as texture1
+
+    particleRendererReady = true;
+}
+
+void UnloadParticleRenderer(void) {
+    if (!particleRendererReady) return;
+
+    // NOTE: Block atlas is owned by the voxel renderer, only free what was loaded here
+    RL_FREE(particleMaterial.maps);
+    particleMaterial = (Material){ 0 };
+    UnloadShader(particleShader);
+    UnloadTexture(particleSheet);
+    UnloadMesh(quadMesh);
+
+    particleShader = (Shader){ 0 };
+    particleSheet = (Texture2D){ 0 };
+    quadMesh = (Mesh){ 0 };
+    particleRendererReady = false;
+}
+
+void DrawParticles(const ParticleRenderList* list, Camera3D camera) {
+    if (!particleRendererReady || (list->count == 0)) return;
+
+    // Billboard axes from the view matrix
+    Matrix view = MatrixLookAt(camera.position, camera.target, camera.up);
+    Vector3 right = { view.m0, view.m4, view.m8 };
+    Vector3 up = { view.m1, view.m5, view.m9 };
+    SetShaderValue(particleShader, cameraRightLoc, &right, SHADER_UNIFORM_VEC3);
+    SetShaderValue(particleShader, cameraUpLoc, &up, SHADER_UNIFORM_VEC3);
+
+    // Atlas can be rebuilt by the texture manager, bind the current one
+    particleMaterial.maps[MATERIAL_MAP_DIFFUSE].texture = GetTextureAtlas();
+
+    DrawMeshInstanced(quadMesh, particleMaterial, list->instances, list->count);
+    RenderStatsAddDrawCall(RENDER_PASS_OPAQUE, quadMesh.vertexCount*list->count, quadMesh.triangleCount*list->count);
+}
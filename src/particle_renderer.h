@@ -0,0 +1,21 @@
+#ifndef PARTICLE_RENDERER_H
+#define PARTICLE_RENDERER_H
+
+#include "particle_system.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Particle Rendering Functions (main thread only)
+//----------------------------------------------------------------------------------
+void InitParticleRenderer(void);
+void UnloadParticleRenderer(void);
+void DrawParticles(const ParticleRenderList* list, Camera3D camera);   // Single instanced draw call (inside BeginMode3D)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PARTICLE_RENDERER_H
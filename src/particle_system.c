@@ -0,0 +1,300 @@
+#include "particle_system.h"
+#include "voxel_renderer.h"
+#include "raymath.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>
+    #define PARTICLES_SSE
+#endif
+
+/*
+---------------------------------------------------------------------------------
+Particle System
+
+Purely visual particles (block break debris, ambient motes). The pool is a fixed set of
+16-byte aligned arrays, one per component (structure of arrays), with live particles
+packed in [0, count). Integration runs four particles at a time with SSE when available:
+gravity, motion, a per-particle floor height and lifetime, with no branches. A scalar
+pass then removes expired particles by swapping in the last one, and the render snapshot
+packs each survivor into one instance matrix for a single instanced draw.
+
+Particles do not collide with the world: each one carries the height of the ground
+under its emitter and comes to rest there. This keeps the update free of block lookups.
+
+---------------------------------------------------------------------------------
+*/
+
+//----------------------------------------------------------------------------------
+// Local Constants and Macros
+//----------------------------------------------------------------------------------
+#define PARTICLE_GRAVITY            20.0f
+#define PARTICLE_GROUND_FRICTION    0.85f   // Horizontal velocity kept per update while resting
+#define PARTICLE_NO_FLOOR           -1.0e9f
+
+#if defined(_MSC_VER)
+    #define ALIGN16 __declspec(align(16))
+#else
+    #define ALIGN16 __attribute__((aligned(16)))
+#endif
+
+//----------------------------------------------------------------------------------
+// Local Variables
+//----------------------------------------------------------------------------------
+// Simulated components (SIMD loop)
+static ALIGN16 float posX[MAX_PARTICLES];
+static ALIGN16 float posY[MAX_PARTICLES];
+static ALIGN16 float posZ[MAX_PARTICLES];
+static ALIGN16 float velX[MAX_PARTICLES];
+static ALIGN16 float velY[MAX_PARTICLES];
+static ALIGN16 float velZ[MAX_PARTICLES];
+static ALIGN16 float gravity[MAX_PARTICLES];        // Gravity scale (motes float, debris falls)
+static ALIGN16 float floorY[MAX_PARTICLES];         // Resting height
+static ALIGN16 float life[MAX_PARTICLES];            // Seconds left
+
+// Render components
+static float size[MAX_PARTICLES];
+static Rectangle uvRect[MAX_PARTICLES];             // Normalized texture region
+static Color tint[MAX_PARTICLES];
+static unsigned char texture[MAX_PARTICLES];        // ParticleTexture
+
+static int particleCount = 0;
+static float ambientBudget = 0.0f;                  // Fractional ambient particles carried between updates
+static unsigned int randomState = 0x2545F491u;
+static ParticleStats stats = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions
+//----------------------------------------------------------------------------------
+static float RandomFloat(float min, float max) {
+    // Xorshift32, simulation thread only
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return min + (max - min)*((randomState & 0xFFFFFF)/16777216.0f);
+}
+
+static int AddParticle(Vector3 position, Vector3 velocity, float lifetime, float particleSize,
+                       float gravityScale, float restHeight, Rectangle region, Color color, ParticleTexture source) {
+    if (particleCount >= MAX_PARTICLES) return -1;
+
+    int i = particleCount++;
+    posX[i] = position.x; posY[i] = position.y; posZ[i] = position.z;
+    velX[i] = velocity.x; velY[i] = velocity.y; velZ[i] = velocity.z;
+    gravity[i] = gravityScale;
+    floorY[i] = restHeight + particleSize*0.5f;     // Quad center, so the sprite sits on the ground
+    life[i] = lifetime;
+    size[i] = particleSize;
+    uvRect[i] = region;
+    tint[i] = color;
+    texture[i] = (unsigned char)source;
+    return i;
+}
+
+static void MoveParticle(int to, int from) {
+    posX[to] = posX[from]; posY[to] = posY[from]; posZ[to] = posZ[from];
+    velX[to] = velX[from]; velY[to] = velY[from]; velZ[to] = velZ[from];
+    gravity[to] = gravity[from];
+    floorY[to] = floorY[from];
+    life[to] = life[from];
+    size[to] = size[from];
+    uvRect[to] = uvRect[from];
+    tint[to] = tint[from];
+    texture[to] = texture[from];
+}
+
+// Integrate particles [0, count), branch free
+static void IntegrateParticles(int count, float deltaTime) {
+    int i = 0;
+
+#if defined(PARTICLES_SSE)
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 fall = _mm_set1_ps(PARTICLE_GRAVITY*deltaTime);
+    const __m128 friction = _mm_set1_ps(PARTICLE_GROUND_FRICTION);
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 vx = _mm_load_ps(&velX[i]);
+        __m128 vy = _mm_load_ps(&velY[i]);
+        __m128 vz = _mm_load_ps(&velZ[i]);
+
+        vy = _mm_sub_ps(vy, _mm_mul_ps(_mm_load_ps(&gravity[i]), fall));
+
+        __m128 px = _mm_add_ps(_mm_load_ps(&posX[i]), _mm_mul_ps(vx, dt));
+        __m128 py = _mm_add_ps(_mm_load_ps(&posY[i]), _mm_mul_ps(vy, dt));
+        __m128 pz = _mm_add_ps(_mm_load_ps(&posZ[i]), _mm_mul_ps(vz, dt));
+
+        // Below the floor: clamp to it, stop falling and slide with friction
+        __m128 ground = _mm_load_ps(&floorY[i]);
+        __m128 resting = _mm_cmple_ps(py, ground);
+        py = _mm_max_ps(py, ground);
+        vy = _mm_andnot_ps(resting, vy);
+        vx = _mm_or_ps(_mm_and_ps(resting, _mm_mul_ps(vx, friction)), _mm_andnot_ps(resting, vx));
+        vz = _mm_or_ps(_mm_and_ps(resting, _mm_mul_ps(vz, friction)), _mm_andnot_ps(resting, vz));
+
+        _mm_store_ps(&posX[i], px);
+        _mm_store_ps(&posY[i], py);
+        _mm_store_ps(&posZ[i], pz);
+        _mm_store_ps(&velX[i], vx);
+        _mm_store_ps(&velY[i], vy);
+        _mm_store_ps(&velZ[i], vz);
+        _mm_store_ps(&life[i], _mm_sub_ps(_mm_load_ps(&life[i]), dt));
+    }
+#endif
+
+    // Scalar path: remainder, or everything without SSE
+    for (; i < count; i++) {
+        velY[i] -= gravity[i]*PARTICLE_GRAVITY*deltaTime;
+
+        posX[i] += velX[i]*deltaTime;
+        posY[i] += velY[i]*deltaTime;
+        posZ[i] += velZ[i]*deltaTime;
+
+        if (posY[i] <= floorY[i]) {
+            posY[i] = floorY[i];
+            velY[i] = 0.0f;
+            velX[i] *= PARTICLE_GROUND_FRICTION;
+            velZ[i] *= PARTICLE_GROUND_FRICTION;
+        }
+
+        life[i] -= deltaTime;
+    }
+}
+
+// Top of the highest solid block below y in the column (no floor if none is loaded)
+static float FindRestHeight(VoxelWorld* world, int x, int y, int z) {
+    BlockLookupCache lookup = { 0 };
+
+    for (int h = y; h >= 0; h--) {
+        if (IsBlockSolid(GetBlockCached(world, &lookup, x, h, z))) return (float)(h + 1);
+    }
+    return PARTICLE_NO_FLOOR;
+}
+
+static void EmitAmbientParticles(VoxelWorld* world, Vector3 center, float deltaTime) {
+    ambientBudget += PARTICLE_AMBIENT_RATE*deltaTime;
+
+    BlockLookupCache lookup = { 0 };
+    while (ambientBudget >= 1.0f) {
+        ambientBudget -= 1.0f;
+
+        Vector3 position = {
+            center.x + RandomFloat(-PARTICLE_AMBIENT_RADIUS, PARTICLE_AMBIENT_RADIUS),
+            center.y + RandomFloat(-2.0f, 6.0f),
+            center.z + RandomFloat(-PARTICLE_AMBIENT_RADIUS, PARTICLE_AMBIENT_RADIUS)
+        };
+
+        // Motes only float in open air
+        BlockType block = GetBlockCached(world, &lookup, (int)floorf(position.x), (int)floorf(position.y), (int)floorf(position.z));
+        if (block != BLOCK_AIR) continue;
+
+        // Generic puff sprites, first row of the 16x16 particle sheet
+        int frame = (int)RandomFloat(0.0f, 8.0f);
+        Rectangle region = { frame/16.0f, 0.0f, 1.0f/16.0f, 1.0f/16.0f };
+        Vector3 drift = { RandomFloat(-0.3f, 0.3f), RandomFloat(0.05f, 0.3f), RandomFloat(-0.3f, 0.3f) };
+
+        AddParticle(position, drift, RandomFloat(3.0f, 6.0f), RandomFloat(0.05f, 0.1f), 0.0f,
+                    PARTICLE_NO_FLOOR, region, (Color){ 235, 235, 220, 255 }, PARTICLE_TEXTURE_SPRITES);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Particle Simulation Functions
+//----------------------------------------------------------------------------------
+void InitParticleSystem(void) {
+    ClearParticles();
+}
+
+void ClearParticles(void) {
+    particleCount = 0;
+    ambientBudget = 0.0f;
+    stats = (ParticleStats){ 0 };
+}
+
+void UpdateParticles(VoxelWorld* world, Vector3 viewerPosition, float deltaTime) {
+    double startTime = GetTime();
+
+    IntegrateParticles(particleCount, deltaTime);
+
+    // Remove expired particles, order does not matter
+    for (int i = 0; i < particleCount; ) {
+        if (life[i] > 0.0f) {
+            i++;
+            continue;
+        }
+        MoveParticle(i, --particleCount);
+    }
+
+    EmitAmbientParticles(world, viewerPosition, deltaTime);
+
+    stats.particleCount = particleCount;
+    stats.updateTime = (float)((GetTime() - startTime)*1000.0);
+}
+
+void EmitBlockBreakParticles(VoxelWorld* world, BlockPos position, BlockType block) {
+    // Debris samples random quarter tiles of the block side texture
+    float u, v, w, h;
+    GetBlockTextureUV(block, FACE_FRONT, &u, &v, &w, &h);
+
+    float restHeight = FindRestHeight(world, position.x, position.y, position.z);
+
+    for (int i = 0; i < PARTICLE_BREAK_COUNT; i++) {
+        Vector3 offset = { RandomFloat(0.1f, 0.9f), RandomFloat(0.1f, 0.9f), RandomFloat(0.1f, 0.9f) };
+        Vector3 spawn = { position.x + offset.x, position.y + offset.y, position.z + offset.z };
+        Vector3 velocity = {
+            (offset.x - 0.5f)*4.0f + RandomFloat(-0.5f, 0.5f),
+            RandomFloat(1.5f, 4.0f),
+            (offset.z - 0.5f)*4.0f + RandomFloat(-0.5f, 0.5f)
+        };
+
+        Rectangle region = {
+            u + w*RandomFloat(0.0f, 0.75f),
+            v + h*RandomFloat(0.0f, 0.75f),
+            w*0.25f,
+            h*0.25f
+        };
+
+        AddParticle(spawn, velocity, RandomFloat(0.5f, 1.2f), RandomFloat(0.08f, 0.15f), 1.0f,
+                    restHeight, region, WHITE, PARTICLE_TEXTURE_BLOCKS);
+    }
+}
+
+void RunParticleStressTest(Vector3 center) {
+    int before = particleCount;
+
+    for (int i = 0; i < PARTICLE_STRESS_COUNT; i++) {
+        Vector3 position = { center.x + RandomFloat(-8.0f, 8.0f), center.y + RandomFloat(2.0f, 10.0f), center.z + RandomFloat(-8.0f, 8.0f) };
+        Vector3 velocity = { RandomFloat(-2.0f, 2.0f), RandomFloat(0.0f, 6.0f), RandomFloat(-2.0f, 2.0f) };
+        int frame = (int)RandomFloat(0.0f, 8.0f);
+        Rectangle region = { frame/16.0f, 0.0f, 1.0f/16.0f, 1.0f/16.0f };
+
+        if (AddParticle(position, velocity, RandomFloat(4.0f, 8.0f), 0.1f, 0.5f, center.y,
+                        region, ORANGE, PARTICLE_TEXTURE_SPRITES) < 0) break;
+    }
+
+    printf("Particle stress test: spawned %d particles (%d alive), see HUD for update cost\n",
+           particleCount - before, particleCount);
+}
+
+void BuildParticleRenderList(ParticleRenderList* list) {
+    if (!list->instances) list->instances = (Matrix*)malloc(MAX_PARTICLES*sizeof(Matrix));
+
+    // Column-major packing, matches the instanceTransform attribute of particle_instanced.vs
+    for (int i = 0; i < particleCount; i++) {
+        Matrix* instance = &list->instances[i];
+        instance->m0 = posX[i]; instance->m1 = posY[i]; instance->m2 = posZ[i]; instance->m3 = size[i];
+        instance->m4 = uvRect[i].x; instance->m5 = uvRect[i].y; instance->m6 = uvRect[i].width; instance->m7 = uvRect[i].height;
+        instance->m8 = tint[i].r/255.0f; instance->m9 = tint[i].g/255.0f; instance->m10 = tint[i].b/255.0f; instance->m11 = tint[i].a/255.0f;
+        instance->m12 = (float)texture[i]; instance->m13 = 0.0f; instance->m14 = 0.0f; instance->m15 = 0.0f;
+    }
+
+    list->count = particleCount;
+    list->stats = stats;
+}
+
+void UnloadParticleRenderList(ParticleRenderList* list) {
+    free(list->instances);
+    *list = (ParticleRenderList){ 0 };
+}
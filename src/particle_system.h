@@ -0,0 +1,54 @@
+#ifndef PARTICLE_SYSTEM_H
+#define PARTICLE_SYSTEM_H
+
+#include "voxel_types.h"
+#include "voxel_world.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Particle Constants
+//----------------------------------------------------------------------------------
+#define MAX_PARTICLES               65536   // Fixed pool, emitters drop particles once full
+#define PARTICLE_BREAK_COUNT        32      // Debris particles per broken block
+#define PARTICLE_AMBIENT_RATE       40.0f   // Ambient particles spawned per second around the viewer
+#define PARTICLE_AMBIENT_RADIUS     12.0f
+#define PARTICLE_STRESS_COUNT       50000   // Particles added by the stress test
+
+// Texture sampled by a particle
+typedef enum {
+    PARTICLE_TEXTURE_BLOCKS = 0,    // Block atlas (debris)
+    PARTICLE_TEXTURE_SPRITES        // resources/textures/particle/particles.png
+} ParticleTexture;
+
+typedef struct {
+    int particleCount;
+    float updateTime;               // Milliseconds spent in the last UpdateParticles() call
+} ParticleStats;
+
+// Instance data of one frame (filled by the simulation thread)
+// NOTE: Each instance is packed in a Matrix, columns: position + size, uv rect, tint, texture
+typedef struct {
+    Matrix* instances;              // MAX_PARTICLES entries, allocated on first use
+    int count;
+    ParticleStats stats;
+} ParticleRenderList;
+
+//----------------------------------------------------------------------------------
+// Particle Simulation Functions (simulation thread)
+//----------------------------------------------------------------------------------
+void InitParticleSystem(void);
+void ClearParticles(void);
+void UpdateParticles(VoxelWorld* world, Vector3 viewerPosition, float deltaTime);   // Integrate, expire and emit ambient
+void EmitBlockBreakParticles(VoxelWorld* world, BlockPos position, BlockType block);
+void RunParticleStressTest(Vector3 center);
+void BuildParticleRenderList(ParticleRenderList* list);
+void UnloadParticleRenderList(ParticleRenderList* list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PARTICLE_SYSTEM_H
@@ -0,0 +1,266 @@
+#include "platform_threads.h"
+#include <stdlib.h>
+
+/*
+---------------------------------------------------------------------------------
+Platform Threads
+
+Thin wrapper over native threads, mutexes and condition variables (Win32 or pthreads).
+This translation unit must not include raylib.h: windows.h declares symbols that clash
+with raylib (CloseWindow, ShowCursor, Rectangle...), so platform types stay opaque.
+On platforms without thread support every StartThread() call returns NULL and the
+synchronization primitives are no-ops, callers then execute their work inline.
+
+---------------------------------------------------------------------------------
+*/
+
+#if defined(SUPPORT_THREADS)
+    #if defined(_WIN32)
+        #define WIN32_LEAN_AND_MEAN
+        #include <windows.h>
+    #else
+        #include <pthread.h>
+        #include <sched.h>
+        #include <unistd.h>
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct Thread {
+#if defined(SUPPORT_THREADS)
+    #if defined(_WIN32)
+    HANDLE handle;
+    #else
+    pthread_t handle;
+    #endif
+#endif
+    ThreadFunc func;
+    void* userData;
+};
+
+struct Mutex {
+#if defined(SUPPORT_THREADS)
+    #if defined(_WIN32)
+    CRITICAL_SECTION handle;
+    #else
+    pthread_mutex_t handle;
+    #endif
+#endif
+    int unused;
+};
+
+struct CondVar {
+#if defined(SUPPORT_THREADS)
+    #if defined(_WIN32)
+    CONDITION_VARIABLE handle;
+    #else
+    pthread_cond_t handle;
+    #endif
+#endif
+    int unused;
+};
+
+//----------------------------------------------------------------------------------
+// Thread Functions
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+static DWORD WINAPI ThreadEntry(LPVOID param) {
+    Thread* thread = (Thread*)param;
+    thread->func(thread->userData);
+    return 0;
+}
+#else
+static void* ThreadEntry(void* param) {
+    Thread* thread = (Thread*)param;
+    thread->func(thread->userData);
+    return NULL;
+}
+#endif
+#endif
+
+Thread* StartThread(ThreadFunc func, void* userData) {
+#if defined(SUPPORT_THREADS)
+    Thread* thread = (Thread*)calloc(1, sizeof(Thread));
+    if (!thread) return NULL;
+
+    thread->func = func;
+    thread->userData = userData;
+
+#if defined(_WIN32)
+    thread->handle = CreateThread(NULL, 0, ThreadEntry, thread, 0, NULL);
+    if (thread->handle == NULL) {
+        free(thread);
+        return NULL;
+    }
+#else
+    if (pthread_create(&thread->handle, NULL, ThreadEntry, thread) != 0) {
+        free(thread);
+        return NULL;
+    }
+#endif
+    return thread;
+#else
+    (void)func;
+    (void)userData;
+    return NULL;
+#endif
+}
+
+void JoinThread(Thread* thread) {
+    if (!thread) return;
+
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+#else
+    pthread_join(thread->handle, NULL);
+#endif
+#endif
+    free(thread);
+}
+
+void YieldThread(void) {
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+#endif
+}
+
+int GetCpuCoreCount(void) {
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0)? (int)count : 1;
+#endif
+#else
+    return 1;
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Mutex Functions
+//----------------------------------------------------------------------------------
+Mutex* LoadMutex(void) {
+    Mutex* mutex = (Mutex*)calloc(1, sizeof(Mutex));
+    if (!mutex) return NULL;
+
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+    InitializeCriticalSection(&mutex->handle);
+#else
+    pthread_mutex_init(&mutex->handle, NULL);
+#endif
+#endif
+    return mutex;
+}
+
+void UnloadMutex(Mutex* mutex) {
+    if (!mutex) return;
+
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+    DeleteCriticalSection(&mutex->handle);
+#else
+    pthread_mutex_destroy(&mutex->handle);
+#endif
+#endif
+    free(mutex);
+}
+
+void LockMutex(Mutex* mutex) {
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+    EnterCriticalSection(&mutex->handle);
+#else
+    pthread_mutex_lock(&mutex->handle);
+#endif
+#else
+    (void)mutex;
+#endif
+}
+
+void UnlockMutex(Mutex* mutex) {
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+    LeaveCriticalSection(&mutex->handle);
+#else
+    pthread_mutex_unlock(&mutex->handle);
+#endif
+#else
+    (void)mutex;
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Condition Variable Functions
+//----------------------------------------------------------------------------------
+CondVar* LoadCondVar(void) {
+    CondVar* condVar = (CondVar*)calloc(1, sizeof(CondVar));
+    if (!condVar) return NULL;
+
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+    InitializeConditionVariable(&condVar->handle);
+#else
+    pthread_cond_init(&condVar->handle, NULL);
+#endif
+#endif
+    return condVar;
+}
+
+void UnloadCondVar(CondVar* condVar) {
+    if (!condVar) return;
+
+#if defined(SUPPORT_THREADS) && !defined(_WIN32)
+    pthread_cond_destroy(&condVar->handle);
+#endif
+    free(condVar);
+}
+
+void WaitCondVar(CondVar* condVar, Mutex* mutex) {
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+    SleepConditionVariableCS(&condVar->handle, &mutex->handle, INFINITE);
+#else
+    pthread_cond_wait(&condVar->handle, &mutex->handle);
+#endif
+#else
+    (void)condVar;
+    (void)mutex;
+#endif
+}
+
+void SignalCondVar(CondVar* condVar) {
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+    WakeConditionVariable(&condVar->handle);
+#else
+    pthread_cond_signal(&condVar->handle);
+#endif
+#else
+    (void)condVar;
+#endif
+}
+
+void BroadcastCondVar(CondVar* condVar) {
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+    WakeAllConditionVariable(&condVar->handle);
+#else
+    pthread_cond_broadcast(&condVar->handle);
+#endif
+#else
+    (void)condVar;
+#endif
+}
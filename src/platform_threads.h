@@ -0,0 +1,97 @@
+#ifndef PLATFORM_THREADS_H
+#define PLATFORM_THREADS_H
+
+#include <stdbool.h>
+
+//----------------------------------------------------------------------------------
+// Threading Support
+// NOTE: Web builds run without threads, callers must fall back to inline execution
+//----------------------------------------------------------------------------------
+#if !defined(PLATFORM_WEB) && !defined(__EMSCRIPTEN__)
+    #define SUPPORT_THREADS 1
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Opaque Threading Types
+// NOTE: Implementation lives in platform_threads.c, so platform headers (windows.h)
+// never get mixed with raylib.h
+//----------------------------------------------------------------------------------
+typedef struct Thread Thread;
+typedef struct Mutex Mutex;
+typedef struct CondVar CondVar;
+
+typedef void (*ThreadFunc)(void* userData);
+
+//----------------------------------------------------------------------------------
+// Threading Functions
+//----------------------------------------------------------------------------------
+Thread* StartThread(ThreadFunc func, void* userData);   // Returns NULL if threads are not supported
+void JoinThread(Thread* thread);
+void YieldThread(void);                                  // Give up the rest of the time slice
+int GetCpuCoreCount(void);
+
+Mutex* LoadMutex(void);
+void UnloadMutex(Mutex* mutex);
+void LockMutex(Mutex* mutex);
+void UnlockMutex(Mutex* mutex);
+
+CondVar* LoadCondVar(void);
+void UnloadCondVar(CondVar* condVar);
+void WaitCondVar(CondVar* condVar, Mutex* mutex);
+void SignalCondVar(CondVar* condVar);
+void BroadcastCondVar(CondVar* condVar);
+
+//----------------------------------------------------------------------------------
+// Atomic Operations (sequentially consistent)
+//----------------------------------------------------------------------------------
+static inline int AtomicLoad(volatile int* value)
+{
+#if defined(_MSC_VER)
+    return _InterlockedOr((volatile long*)value, 0);
+#else
+    return __atomic_load_n(value, __ATOMIC_SEQ_CST);
+#endif
+}
+
+static inline void AtomicStore(volatile int* value, int newValue)
+{
+#if defined(_MSC_VER)
+    _InterlockedExchange((volatile long*)value, newValue);
+#else
+    __atomic_store_n(value, newValue, __ATOMIC_SEQ_CST);
+#endif
+}
+
+// Returns value after the addition
+static inline int AtomicAdd(volatile int* value, int amount)
+{
+#if defined(_MSC_VER)
+    return _InterlockedExchangeAdd((volatile long*)value, amount) + amount;
+#else
+    return __atomic_add_fetch(value, amount, __ATOMIC_SEQ_CST);
+#endif
+}
+
+// Returns true if value was equal to expected and got replaced by desired
+static inline bool AtomicCompareExchange(volatile int* value, int expected, int desired)
+{
+#if defined(_MSC_VER)
+    return (_InterlockedCompareExchange((volatile long*)value, desired, expected) == expected);
+#else
+    return __atomic_compare_exchange_n(value, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PLATFORM_THREADS_H
@@ -1,5 +1,10 @@
 #include "player.h"
 #include "voxel_renderer.h"
+#include "voxel_raycast.h"
+#include "voxel_collision.h"
+#include "particle_system.h"
+#include "block_ticks.h"
+#include "redstone.h"
 #include "raymath.h"
 #include <math.h>
 
@@ -18,6 +23,7 @@
 //----------------------------------------------------------------------------------
 void InitPlayer(Player* player, Vector3 startPosition) {
     player->position = startPosition;
+    player->previousPosition = startPosition;
     player->velocity = (Vector3){0, 0, 0};
     player->onGround = false;
     player->inWater = false;
@@ -61,13 +67,20 @@ void InitPlayer(Player* player, Vector3 startPosition) {
     player->inventorySelectedSlot = 0;
     player->inventoryScrollOffset = 0;
     
-    // Fill inventory with all available blocks
+    // Fill inventory with the first block types, then the crop and redstone blocks listed at the end of the enum
+    const BlockType simulatedBlocks[] = { BLOCK_WHEAT, BLOCK_REDSTONE_WIRE, BLOCK_REDSTONE_TORCH, BLOCK_LEVER, BLOCK_REDSTONE_LAMP };
+    int simulatedCount = sizeof(simulatedBlocks) / sizeof(simulatedBlocks[0]);
     int slotIndex = 0;
-    for (int i = 1; i < BLOCK_COUNT && slotIndex < INVENTORY_SIZE; i++) {
+    for (int i = 1; i < BLOCK_COUNT && slotIndex < INVENTORY_SIZE - simulatedCount; i++) {
         player->inventory.blocks[slotIndex] = (BlockType)i;
         player->inventory.quantities[slotIndex] = 64; // Full stack
         slotIndex++;
     }
+    for (int i = 0; i < simulatedCount; i++) {
+        player->inventory.blocks[slotIndex] = simulatedBlocks[i];
+        player->inventory.quantities[slotIndex] = 64;
+        slotIndex++;
+    }
     
     // Fill remaining slots with air
     for (int i = slotIndex; i < INVENTORY_SIZE; i++) {
@@ -78,13 +91,24 @@ void InitPlayer(Player* player, Vector3 startPosition) {
     DisableCursor(); // Lock cursor for first-person view
 }
 
-void UpdatePlayer(Player* player, VoxelWorld* world) {
-    HandlePlayerInput(player);
-    UpdatePlayerPhysics(player, world);
-    UpdatePlayerInteraction(player, world);
-    
-    // Update camera position
-    player->camera.position = Vector3Add(player->position, (Vector3){0, PLAYER_HEIGHT * 0.9f, 0});
+void TickPlayer(Player* player, VoxelWorld* world, float deltaTime) {
+    // Keep last tick position so rendering can interpolate between ticks
+    player->previousPosition = player->position;
+    UpdatePlayerPhysics(player, world, deltaTime);
+}
+
+void UpdatePlayerCamera(Player* player, float interpolation) {
+    // Render position lies between the last two simulation ticks
+    Vector3 renderPosition = Vector3Lerp(player->previousPosition, player->position, interpolation);
+    player->camera.position = Vector3Add(renderPosition, (Vector3){0, PLAYER_HEIGHT * 0.9f, 0});
+    
+    // Camera orientation follows mouse look at render rate
+    Vector3 forward = {
+        cosf(player->pitch) * sinf(player->yaw),  // X
+        sinf(player->pitch),                      // Y
+        cosf(player->pitch) * cosf(player->yaw)   // Z
+    };
+    player->camera.target = Vector3Add(player->camera.position, forward);
 }
 
 void HandlePlayerInput(Player* player) {
@@ -139,6 +163,13 @@ void HandlePlayerInput(Player* player) {
         }
     }
     
+    // Block interaction requests, applied by the next simulation frame
+    // NOTE: raylib input state is not thread-safe, so the simulation never polls it directly
+    if (IsCursorHidden()) {
+        if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) player->breakRequested = true;
+        if (IsMouseButtonPressed(MOUSE_BUTTON_RIGHT)) player->placeRequested = true;
+    }
+    
     // Hotbar selection (only when inventory is closed)
     if (!player->inventoryOpen) {
         for (int i = 0; i < 9; i++) {
@@ -212,65 +243,35 @@ void HandlePlayerMouseLook(Player* player) {
         if (player->pitch > maxPitch) player->pitch = maxPitch;
         if (player->pitch < -maxPitch) player->pitch = -maxPitch;
         
-        // Calculate forward vector from yaw and pitch
-        Vector3 forward = {
-            cosf(player->pitch) * sinf(player->yaw),  // X
-            sinf(player->pitch),                      // Y  
-            cosf(player->pitch) * cosf(player->yaw)   // Z
-        };
-        
-        // Update camera target
-        player->camera.target = Vector3Add(player->camera.position, forward);
+        // NOTE: Camera target is rebuilt from yaw/pitch in UpdatePlayerCamera()
     }
 }
 
-void UpdatePlayerPhysics(Player* player, VoxelWorld* world) {
-    float deltaTime = GetFrameTime();
-    
+void UpdatePlayerPhysics(Player* player, VoxelWorld* world, float deltaTime) {
     // Apply gravity
-    ApplyGravity(player);
+    ApplyGravity(player, deltaTime);
     
-    // Check collision and move player
-    Vector3 newPosition = Vector3Add(player->position, Vector3Scale(player->velocity, deltaTime));
+    // Sweep the player box through the grid, each axis stops flush against what it hits
+    Vector3 motion = Vector3Scale(player->velocity, deltaTime);
+    VoxelMoveResult move = MoveBoxThroughWorld(world, GetPlayerBounds(player->position), motion);
+    player->position = Vector3Add(player->position, move.motion);
     
-    // Check Y collision (vertical)
-    Vector3 verticalPos = player->position;
-    verticalPos.y = newPosition.y;
-    if (!CheckCollision(player, world, verticalPos)) {
-        player->position.y = verticalPos.y;
-        player->onGround = false;
-    } else {
-        if (player->velocity.y < 0) {
-            player->onGround = true;
-        }
+    if (move.hitY) {
+        player->onGround = (player->velocity.y < 0);
         player->velocity.y = 0;
-    }
-    
-    // Check X collision (horizontal)
-    Vector3 horizontalPosX = player->position;
-    horizontalPosX.x = newPosition.x;
-    if (!CheckCollision(player, world, horizontalPosX)) {
-        player->position.x = horizontalPosX.x;
     } else {
-        player->velocity.x = 0;
+        player->onGround = false;
     }
     
-    // Check Z collision (horizontal)
-    Vector3 horizontalPosZ = player->position;
-    horizontalPosZ.z = newPosition.z;
-    if (!CheckCollision(player, world, horizontalPosZ)) {
-        player->position.z = horizontalPosZ.z;
-    } else {
-        player->velocity.z = 0;
-    }
+    if (move.hitX) player->velocity.x = 0;
+    if (move.hitZ) player->velocity.z = 0;
     
     // Apply damping
     player->velocity.x *= (1.0f - MOVEMENT_DAMPING);
     player->velocity.z *= (1.0f - MOVEMENT_DAMPING);
 }
 
-void ApplyGravity(Player* player) {
-    float deltaTime = GetFrameTime();
+void ApplyGravity(Player* player, float deltaTime) {
     player->velocity.y -= GRAVITY * deltaTime;
     
     // Terminal velocity
@@ -279,46 +280,27 @@ void ApplyGravity(Player* player) {
     }
 }
 
-bool CheckCollision(Player* player, VoxelWorld* world, Vector3 newPosition) {
-    // Check collision box around player
+BoundingBox GetPlayerBounds(Vector3 position) {
     float halfWidth = PLAYER_WIDTH * 0.5f;
-    
-    // Check multiple points around the player
-    Vector3 checkPoints[8] = {
-        {newPosition.x - halfWidth, newPosition.y, newPosition.z - halfWidth},
-        {newPosition.x + halfWidth, newPosition.y, newPosition.z - halfWidth},
-        {newPosition.x - halfWidth, newPosition.y, newPosition.z + halfWidth},
-        {newPosition.x + halfWidth, newPosition.y, newPosition.z + halfWidth},
-        {newPosition.x - halfWidth, newPosition.y + PLAYER_HEIGHT, newPosition.z - halfWidth},
-        {newPosition.x + halfWidth, newPosition.y + PLAYER_HEIGHT, newPosition.z - halfWidth},
-        {newPosition.x - halfWidth, newPosition.y + PLAYER_HEIGHT, newPosition.z + halfWidth},
-        {newPosition.x + halfWidth, newPosition.y + PLAYER_HEIGHT, newPosition.z + halfWidth}
+    return (BoundingBox){
+        {position.x - halfWidth, position.y, position.z - halfWidth},
+        {position.x + halfWidth, position.y + PLAYER_HEIGHT, position.z + halfWidth}
     };
-    
-    for (int i = 0; i < 8; i++) {
-        BlockPos blockPos = WorldToBlock(checkPoints[i]);
-        BlockType block = GetBlock(world, blockPos);
-        if (IsBlockSolid(block)) {
-            return true; // Collision detected
-        }
-    }
-    
-    return false; // No collision
 }
 
 void UpdatePlayerInteraction(Player* player, VoxelWorld* world) {
     UpdateBlockTarget(player, world);
     
-    if (IsCursorHidden()) {
-        // Block breaking (left click)
-        if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
-            HandleBlockBreaking(player, world);
-        }
-        
-        // Block placement (right click)
-        if (IsMouseButtonPressed(MOUSE_BUTTON_RIGHT)) {
-            HandleBlockPlacement(player, world);
-        }
+    // Block breaking (left click)
+    if (player->breakRequested) {
+        HandleBlockBreaking(player, world);
+        player->breakRequested = false;
+    }
+    
+    // Block placement (right click)
+    if (player->placeRequested) {
+        HandleBlockPlacement(player, world);
+        player->placeRequested = false;
     }
 }
 
@@ -326,42 +308,40 @@ void UpdateBlockTarget(Player* player, VoxelWorld* world) {
     Vector3 rayOrigin = player->camera.position;
     Vector3 rayDirection = Vector3Normalize(Vector3Subtract(player->camera.target, player->camera.position));
     
-    Vector3 hitNormal;
-    player->hasTarget = RaycastToBlock(rayOrigin, rayDirection, world, &player->targetBlock, &hitNormal);
+    VoxelRayHit hit = RaycastVoxels(world, rayOrigin, rayDirection, REACH_DISTANCE);
+    player->hasTarget = hit.hit;
+    player->targetBlock = hit.block;
+    player->targetNormal = hit.normal;
 }
 
 void HandleBlockPlacement(Player* player, VoxelWorld* world) {
     if (!player->hasTarget || player->selectedBlock == BLOCK_AIR) return;
     
-    Vector3 rayOrigin = player->camera.position;
-    Vector3 rayDirection = Vector3Normalize(Vector3Subtract(player->camera.target, player->camera.position));
+    // Using a lever flips it instead of placing against it
+    if (ToggleLever(world, player->targetBlock)) return;
     
-    BlockPos hitBlock;
-    Vector3 hitNormal;
+    // Place against the entry face of this tick's target (set by UpdateBlockTarget)
+    BlockPos placePos = {
+        player->targetBlock.x + (int)player->targetNormal.x,
+        player->targetBlock.y + (int)player->targetNormal.y,
+        player->targetBlock.z + (int)player->targetNormal.z
+    };
     
-    if (RaycastToBlock(rayOrigin, rayDirection, world, &hitBlock, &hitNormal)) {
-        // Calculate placement position (adjacent to hit block)
-        BlockPos placePos = {
-            hitBlock.x + (int)hitNormal.x,
-            hitBlock.y + (int)hitNormal.y,
-            hitBlock.z + (int)hitNormal.z
-        };
-        
-        // Check if placement position is valid and not inside player
-        Vector3 placeWorldPos = {placePos.x + 0.5f, placePos.y + 0.5f, placePos.z + 0.5f};
-        Vector3 playerFeet = player->position;
-        Vector3 playerHead = Vector3Add(player->position, (Vector3){0, PLAYER_HEIGHT, 0});
-        
-        // Don't place block if it would intersect with player
-        bool wouldIntersectPlayer = (
-            placeWorldPos.x >= playerFeet.x - PLAYER_WIDTH/2 && placeWorldPos.x <= playerFeet.x + PLAYER_WIDTH/2 &&
-            placeWorldPos.z >= playerFeet.z - PLAYER_WIDTH/2 && placeWorldPos.z <= playerFeet.z + PLAYER_WIDTH/2 &&
-            placeWorldPos.y >= playerFeet.y && placeWorldPos.y <= playerHead.y
-        );
-        
-        if (!wouldIntersectPlayer && GetBlock(world, placePos) == BLOCK_AIR) {
-            SetBlock(world, placePos, player->selectedBlock);
-        }
+    // Check if placement position is valid and not inside player
+    Vector3 placeWorldPos = {placePos.x + 0.5f, placePos.y + 0.5f, placePos.z + 0.5f};
+    Vector3 playerFeet = player->position;
+    Vector3 playerHead = Vector3Add(player->position, (Vector3){0, PLAYER_HEIGHT, 0});
+    
+    // Don't place block if it would intersect with player
+    bool wouldIntersectPlayer = (
+        placeWorldPos.x >= playerFeet.x - PLAYER_WIDTH/2 && placeWorldPos.x <= playerFeet.x + PLAYER_WIDTH/2 &&
+        placeWorldPos.z >= playerFeet.z - PLAYER_WIDTH/2 && placeWorldPos.z <= playerFeet.z + PLAYER_WIDTH/2 &&
+        placeWorldPos.y >= playerFeet.y && placeWorldPos.y <= playerHead.y
+    );
+    
+    if (!wouldIntersectPlayer && GetBlock(world, placePos) == BLOCK_AIR) {
+        SetBlockWithData(world, placePos, player->selectedBlock, GetPlacedBlockData(player->selectedBlock));
+        NotifyBlockChanged(world, placePos);
     }
 }
 
@@ -371,41 +351,21 @@ void HandleBlockBreaking(Player* player, VoxelWorld* world) {
     BlockType currentBlock = GetBlock(world, player->targetBlock);
     if (currentBlock != BLOCK_AIR) {
         SetBlock(world, player->targetBlock, BLOCK_AIR);
+        EmitBlockBreakParticles(world, player->targetBlock, currentBlock);
+        NotifyBlockChanged(world, player->targetBlock);
+        
+        // Retarget through the removed block so a placement in the same tick sees the new surface
+        UpdateBlockTarget(player, world);
     }
 }
 
 bool RaycastToBlock(Vector3 origin, Vector3 direction, VoxelWorld* world, BlockPos* hitBlock, Vector3* hitNormal) {
-    Vector3 rayPos = origin;
-    Vector3 rayStep = Vector3Scale(Vector3Normalize(direction), 0.1f);
-    
-    for (float distance = 0; distance < REACH_DISTANCE; distance += 0.1f) {
-        BlockPos currentBlock = WorldToBlock(rayPos);
-        BlockType block = GetBlock(world, currentBlock);
-        
-        if (IsBlockSolid(block)) {
-            *hitBlock = currentBlock;
-            
-            // Calculate hit normal (simplified)
-            Vector3 blockCenter = {currentBlock.x + 0.5f, currentBlock.y + 0.5f, currentBlock.z + 0.5f};
-            Vector3 hitPoint = rayPos;
-            Vector3 diff = Vector3Subtract(hitPoint, blockCenter);
-            
-            // Find the largest component to determine which face was hit
-            if (fabsf(diff.x) > fabsf(diff.y) && fabsf(diff.x) > fabsf(diff.z)) {
-                *hitNormal = (Vector3){diff.x > 0 ? 1 : -1, 0, 0};
-            } else if (fabsf(diff.y) > fabsf(diff.z)) {
-                *hitNormal = (Vector3){0, diff.y > 0 ? 1 : -1, 0};
-            } else {
-                *hitNormal = (Vector3){0, 0, diff.z > 0 ? 1 : -1};
-            }
-            
-            return true;
-        }
-        
-        rayPos = Vector3Add(rayPos, rayStep);
-    }
+    VoxelRayHit hit = RaycastVoxels(world, origin, direction, REACH_DISTANCE);
+    if (!hit.hit) return false;
     
-    return false;
+    *hitBlock = hit.block;
+    *hitNormal = hit.normal;
+    return true;
 }
 
 //----------------------------------------------------------------------------------
@@ -534,7 +494,7 @@ void DrawInventory(Player* player) {
     
     // Inventory background
     int inventoryWidth = 600;
-    int inventoryHeight = 400;
+    int inventoryHeight = 500;
     int inventoryX = (screenWidth - inventoryWidth) / 2;
     int inventoryY = (screenHeight - inventoryHeight) / 2;
     
@@ -622,7 +582,7 @@ int GetInventorySlotAtMouse(Vector2 mousePos) {
     int screenHeight = GetScreenHeight();
     
     int inventoryWidth = 600;
-    int inventoryHeight = 400;
+    int inventoryHeight = 500;
     int inventoryX = (screenWidth - inventoryWidth) / 2;
     int inventoryY = (screenHeight - inventoryHeight) / 2;
     
@@ -778,6 +738,11 @@ const char* GetBlockName(BlockType block) {
         case BLOCK_CACTUS: return "Cactus";
         case BLOCK_SPONGE: return "Sponge";
         case BLOCK_WET_SPONGE: return "Wet Sponge";
+        case BLOCK_WHEAT: return "Wheat";
+        case BLOCK_REDSTONE_WIRE: return "Redstone Wire";
+        case BLOCK_REDSTONE_TORCH: return "Redstone Torch";
+        case BLOCK_LEVER: return "Lever";
+        case BLOCK_REDSTONE_LAMP: return "Redstone Lamp";
         default: return "Unknown Block";
     }
 } 
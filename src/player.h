@@ -12,16 +12,17 @@ extern "C" {
 // Player Functions
 //----------------------------------------------------------------------------------
 void InitPlayer(Player* player, Vector3 startPosition);
-void UpdatePlayer(Player* player, VoxelWorld* world);
-void HandlePlayerInput(Player* player);
-void UpdatePlayerPhysics(Player* player, VoxelWorld* world);
+void TickPlayer(Player* player, VoxelWorld* world, float deltaTime);     // Fixed-rate simulation tick
+void HandlePlayerInput(Player* player);                                  // Once per render frame
+void UpdatePlayerPhysics(Player* player, VoxelWorld* world, float deltaTime);
+void UpdatePlayerCamera(Player* player, float interpolation);            // Interpolate between last two ticks
 void UpdatePlayerInteraction(Player* player, VoxelWorld* world);
 
 // Movement functions
 void HandlePlayerMovement(Player* player);
 void HandlePlayerMouseLook(Player* player);
-void ApplyGravity(Player* player);
-bool CheckCollision(Player* player, VoxelWorld* world, Vector3 newPosition);
+void ApplyGravity(Player* player, float deltaTime);
+BoundingBox GetPlayerBounds(Vector3 position);                           // Collision box, position at the feet
 
 // Block interaction
 void UpdateBlockTarget(Player* player, VoxelWorld* world);
@@ -10,6 +10,8 @@
 
 #include "raylib.h"
 #include "screens.h"    // NOTE: Declares global (extern) variables and screens functions
+#include "job_system.h"
+#include "frame_scheduler.h"
 #include <stdio.h>
 
 #if defined(PLATFORM_WEB)
@@ -57,9 +59,11 @@ int main(void)
 {
     // Initialization
     //---------------------------------------------------------
+    SetConfigFlags(FLAG_VSYNC_HINT);    // Pace uncapped gameplay rendering to the display
     InitWindow(screenWidth, screenHeight, "MC.C");
 
     InitAudioDevice();      // Initialize audio device
+    InitJobSystem(0);       // Worker pool sized to the available cores
 
     // Load global data (assets that must be available in all screens, i.e. font)
     font = LoadFont("resources/mecha.png");
@@ -79,7 +83,7 @@ int main(void)
 #if defined(PLATFORM_WEB)
     emscripten_set_main_loop(UpdateDrawFrame, 60, 1);
 #else
-    SetTargetFPS(60);       // Set our game to run at 60 frames-per-second
+    SetTargetFPS(60);       // Set our game to run at 60 frames-per-second (gameplay screen uncaps it)
     //--------------------------------------------------------------------------------------
 
     // Main game loop
@@ -107,6 +111,9 @@ int main(void)
     UnloadMusicStream(music);
     UnloadSound(fxCoin);
 
+    UnloadFrameScheduler(); // Run and free pending main-thread tasks
+    UnloadJobSystem();      // Stop worker threads
+
     CloseAudioDevice();     // Close audio context
 
     CloseWindow();          // Close window and OpenGL context
@@ -0,0 +1,538 @@
+#include "redstone.h"
+#include "block_pos_set.h"
+#include "raylib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/*
+---------------------------------------------------------------------------------
+Redstone
+
+Signal simulation over a compiled graph of components instead of the blocks themselves.
+
+Every component block (wire, torch, lever, lamp, redstone block) is a node that stores its
+adjacent components as graph edges. Edges are compiled incrementally: placing or breaking a
+component only links or unlinks that node with its six neighbors. Connected wires are also
+compiled into wire nets, the member list of one connected wire run. A net is dissolved when
+a wire joins or leaves it and recompiled the next time it is evaluated.
+
+Nothing is re-scanned per tick. A node is evaluated only when an event for it is due, and
+an event is only posted when one of its inputs changed:
+    Wire net        power = max(adjacent source output, neighbor wire power - 1), solved for
+                    the whole net at once by a bucket BFS from level 15 down to 1
+    Torch           inverter, off while the component below it outputs power (2 tick delay)
+    Lamp            lit while any adjacent component outputs power
+    Lever, block    constant sources (levers toggled by the player)
+When a node output changes its neighbors get an event. Events live in a timing wheel indexed
+by tick (delays are short constants), zero delay events run within the same tick. At most
+REDSTONE_MAX_EVENTS_PER_TICK events run per tick, overflow moves to the next tick.
+
+Block data only mirrors the visible state (powered wire, lit torch or lamp), written when it
+flips, so the signal level changing inside a wire run does not remesh anything.
+
+---------------------------------------------------------------------------------
+*/
+
+//----------------------------------------------------------------------------------
+// Local Constants
+//----------------------------------------------------------------------------------
+#define EVENT_WHEEL_SIZE        8       // Power of two above the longest delay
+#define DIRECTION_DOWN          2       // Index of {0, -1, 0} in neighborOffsets
+#define DIRECTION_UP            3
+#define BENCHMARK_LINE_LENGTH   13      // Wires after the clock until the signal dies out
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef enum {
+    NODE_FREE = 0,
+    NODE_WIRE,
+    NODE_TORCH,
+    NODE_LEVER,
+    NODE_POWER_BLOCK,
+    NODE_LAMP
+} RedstoneNodeType;
+
+typedef struct {
+    BlockPos position;
+    unsigned char type;             // RedstoneNodeType
+    unsigned char power;            // Output level (lamps: 1 while lit)
+    unsigned char pendingPower;     // Wire level being solved by the net evaluation
+    bool queued;                    // Waiting in the event wheel
+    int net;                        // Compiled wire net, -1 if not compiled (or not a wire)
+    int neighbors[6];               // Compiled edges: adjacent component per direction, -1 if none
+} RedstoneNode;
+
+typedef struct {
+    int* items;
+    int count;
+    int capacity;
+} IndexList;
+
+typedef struct {
+    IndexList wires;                // Member wire nodes
+    bool queued;                    // One event per net is enough
+} WireNet;
+
+//----------------------------------------------------------------------------------
+// Local Variables
+//----------------------------------------------------------------------------------
+static RedstoneNode* nodes = NULL;
+static int nodeCapacity = 0;
+static int nodesUsed = 0;               // High water mark of the node array
+static int liveNodes = 0;
+static IndexList freeNodes = {0};
+static BlockPosSet nodeMap = {0};       // Block position -> node index
+
+static WireNet* nets = NULL;
+static int netCapacity = 0;
+static int netsUsed = 0;
+static int liveNets = 0;
+static IndexList freeNets = {0};
+
+static IndexList eventWheel[EVENT_WHEEL_SIZE] = {0};
+static IndexList levelBuckets[REDSTONE_MAX_POWER + 1] = {0};
+static unsigned int currentTick = 0;
+static RedstoneStats stats = {0};
+
+static const BlockPos neighborOffsets[6] = { {-1, 0, 0}, {1, 0, 0}, {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1} };
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions
+//----------------------------------------------------------------------------------
+static void PushIndex(IndexList* list, int index) {
+    if (list->count >= list->capacity) {
+        list->capacity = (list->capacity > 0)? list->capacity*2 : 256;
+        list->items = (int*)realloc(list->items, list->capacity*sizeof(int));
+    }
+    list->items[list->count++] = index;
+}
+
+static void FreeIndexList(IndexList* list) {
+    free(list->items);
+    *list = (IndexList){0};
+}
+
+static RedstoneNodeType GetComponentType(BlockType block) {
+    switch (block) {
+        case BLOCK_REDSTONE_WIRE: return NODE_WIRE;
+        case BLOCK_REDSTONE_TORCH: return NODE_TORCH;
+        case BLOCK_LEVER: return NODE_LEVER;
+        case BLOCK_REDSTONE_BLOCK: return NODE_POWER_BLOCK;
+        case BLOCK_REDSTONE_LAMP: return NODE_LAMP;
+        default: return NODE_FREE;
+    }
+}
+
+static BlockPos OffsetPosition(BlockPos position, int direction) {
+    return (BlockPos){ position.x + neighborOffsets[direction].x, position.y + neighborOffsets[direction].y,
+                       position.z + neighborOffsets[direction].z };
+}
+
+// Power a node sends to the neighbor in the given direction
+static int GetOutputTowards(const RedstoneNode* node, int direction) {
+    switch (node->type) {
+        case NODE_POWER_BLOCK: return REDSTONE_MAX_POWER;
+        case NODE_LEVER:
+        case NODE_WIRE: return node->power;
+        case NODE_TORCH: return (direction == DIRECTION_DOWN)? 0 : node->power;   // Never powers its own input
+        default: return 0;
+    }
+}
+
+static void ScheduleNode(int index, int delay) {
+    RedstoneNode* node = &nodes[index];
+
+    if ((node->type == NODE_WIRE) && (node->net >= 0)) {
+        if (nets[node->net].queued) return;
+        nets[node->net].queued = true;
+    } else {
+        if (node->queued) return;
+        node->queued = true;
+    }
+
+    PushIndex(&eventWheel[(currentTick + delay) & (EVENT_WHEEL_SIZE - 1)], index);
+}
+
+// An input of the node changed
+static void ScheduleInput(int index) {
+    ScheduleNode(index, (nodes[index].type == NODE_TORCH)? REDSTONE_TORCH_DELAY : 0);
+}
+
+static void ScheduleNeighbors(int index) {
+    for (int d = 0; d < 6; d++) {
+        if (nodes[index].neighbors[d] >= 0) ScheduleInput(nodes[index].neighbors[d]);
+    }
+}
+
+static void DissolveNet(int netIndex) {
+    if (netIndex < 0) return;
+
+    WireNet* net = &nets[netIndex];
+    for (int i = 0; i < net->wires.count; i++) nodes[net->wires.items[i]].net = -1;
+    net->wires.count = 0;
+    net->queued = false;
+
+    PushIndex(&freeNets, netIndex);
+    liveNets--;
+}
+
+// Collect the wire run around a wire into a new net
+static void CompileNet(int index) {
+    int netIndex;
+    if (freeNets.count > 0) netIndex = freeNets.items[--freeNets.count];
+    else {
+        if (netsUsed >= netCapacity) {
+            int newCapacity = (netCapacity > 0)? netCapacity*2 : 256;
+            nets = (WireNet*)realloc(nets, newCapacity*sizeof(WireNet));
+            memset(nets + netCapacity, 0, (newCapacity - netCapacity)*sizeof(WireNet));
+            netCapacity = newCapacity;
+        }
+        netIndex = netsUsed++;      // Slots below netCapacity keep their member storage across InitRedstone()
+    }
+    liveNets++;
+
+    WireNet* net = &nets[netIndex];
+    net->wires.count = 0;
+    net->queued = false;
+
+    nodes[index].net = netIndex;
+    PushIndex(&net->wires, index);
+
+    for (int i = 0; i < net->wires.count; i++) {
+        const RedstoneNode* wire = &nodes[net->wires.items[i]];
+
+        for (int d = 0; d < 6; d++) {
+            int neighbor = wire->neighbors[d];
+            if ((neighbor < 0) || (nodes[neighbor].type != NODE_WIRE) || (nodes[neighbor].net >= 0)) continue;
+
+            nodes[neighbor].net = netIndex;
+            PushIndex(&net->wires, neighbor);
+        }
+    }
+}
+
+static int AddNode(BlockPos position, RedstoneNodeType type, unsigned char data) {
+    int index;
+    if (freeNodes.count > 0) index = freeNodes.items[--freeNodes.count];
+    else {
+        if (nodesUsed >= nodeCapacity) {
+            nodeCapacity = (nodeCapacity > 0)? nodeCapacity*2 : 1024;
+            nodes = (RedstoneNode*)realloc(nodes, nodeCapacity*sizeof(RedstoneNode));
+        }
+        index = nodesUsed++;
+    }
+    liveNodes++;
+
+    RedstoneNode* node = &nodes[index];
+    *node = (RedstoneNode){ .position = position, .type = (unsigned char)type, .net = -1 };
+
+    // Sources keep the state they were placed with, wires and lamps are evaluated below
+    if (type == NODE_POWER_BLOCK) node->power = REDSTONE_MAX_POWER;
+    else if ((type == NODE_TORCH) || (type == NODE_LEVER)) node->power = (data & REDSTONE_POWERED)? REDSTONE_MAX_POWER : 0;
+
+    // Link the compiled edges both ways, joining wires merge their nets
+    for (int d = 0; d < 6; d++) {
+        int neighbor = GetBlockPosValue(&nodeMap, OffsetPosition(position, d), -1);
+        node->neighbors[d] = neighbor;
+        if (neighbor < 0) continue;
+
+        nodes[neighbor].neighbors[d ^ 1] = index;
+        if ((type == NODE_WIRE) && (nodes[neighbor].type == NODE_WIRE)) DissolveNet(nodes[neighbor].net);
+    }
+    SetBlockPosValue(&nodeMap, position, index);
+
+    ScheduleInput(index);
+    ScheduleNeighbors(index);
+    return index;
+}
+
+static void RemoveNode(int index) {
+    RedstoneNode* node = &nodes[index];
+    if (node->type == NODE_WIRE) DissolveNet(node->net);
+
+    for (int d = 0; d < 6; d++) {
+        int neighbor = node->neighbors[d];
+        if (neighbor < 0) continue;
+
+        nodes[neighbor].neighbors[d ^ 1] = -1;
+        ScheduleInput(neighbor);
+    }
+
+    RemoveBlockPos(&nodeMap, node->position);
+    node->type = NODE_FREE;
+    node->queued = false;
+    PushIndex(&freeNodes, index);
+    liveNodes--;
+}
+
+// Mirror the visible state into the block data (remeshes only when it flips)
+static void SyncBlockData(VoxelWorld* world, BlockLookupCache* cache, const RedstoneNode* node, BlockType block) {
+    if (node->type == NODE_LEVER) return;     // The lever data is the input, not a mirror
+
+    BlockPos p = node->position;
+    unsigned char data = GetBlockDataCached(world, cache, p.x, p.y, p.z);
+    unsigned char synced = (node->power > 0)? (data | REDSTONE_POWERED) : (data & ~REDSTONE_POWERED);
+    if (synced != data) SetBlockCached(world, cache, p.x, p.y, p.z, block, synced);
+}
+
+// Solve the power of every wire of a net, returns the number of wires that changed
+static int EvaluateNet(VoxelWorld* world, BlockLookupCache* cache, int netIndex) {
+    IndexList* wires = &nets[netIndex].wires;
+    for (int level = 0; level <= REDSTONE_MAX_POWER; level++) levelBuckets[level].count = 0;
+
+    // Seed with the power entering from adjacent sources
+    for (int i = 0; i < wires->count; i++) {
+        RedstoneNode* wire = &nodes[wires->items[i]];
+        int level = 0;
+
+        for (int d = 0; d < 6; d++) {
+            int neighbor = wire->neighbors[d];
+            if ((neighbor < 0) || (nodes[neighbor].type == NODE_WIRE)) continue;
+
+            int input = GetOutputTowards(&nodes[neighbor], d ^ 1);
+            if (input > level) level = input;
+        }
+
+        wire->pendingPower = (unsigned char)level;
+        if (level > 0) PushIndex(&levelBuckets[level], wires->items[i]);
+    }
+
+    // Spread from the strongest level down, each wire settles the first time it is reached
+    for (int level = REDSTONE_MAX_POWER; level > 1; level--) {
+        for (int i = 0; i < levelBuckets[level].count; i++) {
+            const RedstoneNode* wire = &nodes[levelBuckets[level].items[i]];
+            if (wire->pendingPower != level) continue;
+
+            for (int d = 0; d < 6; d++) {
+                int neighbor = wire->neighbors[d];
+                if ((neighbor < 0) || (nodes[neighbor].type != NODE_WIRE) || (nodes[neighbor].pendingPower >= level - 1)) continue;
+
+                nodes[neighbor].pendingPower = (unsigned char)(level - 1);
+                PushIndex(&levelBuckets[level - 1], neighbor);
+            }
+        }
+    }
+
+    // Publish the new levels, components fed by changed wires get an event
+    int changes = 0;
+    for (int i = 0; i < wires->count; i++) {
+        int index = wires->items[i];
+        RedstoneNode* wire = &nodes[index];
+        if (wire->pendingPower == wire->power) continue;
+
+        wire->power = wire->pendingPower;
+        SyncBlockData(world, cache, wire, BLOCK_REDSTONE_WIRE);
+        changes++;
+
+        for (int d = 0; d < 6; d++) {
+            int neighbor = wire->neighbors[d];
+            if ((neighbor >= 0) && (nodes[neighbor].type != NODE_WIRE)) ScheduleInput(neighbor);
+        }
+    }
+
+    return changes;
+}
+
+// Returns the number of components whose output changed
+static int EvaluateNode(VoxelWorld* world, BlockLookupCache* cache, int index) {
+    RedstoneNode* node = &nodes[index];
+    BlockPos p = node->position;
+
+    // The world is the reference: drop nodes whose block is gone (replaced or chunk unloaded)
+    BlockType block = GetBlockCached(world, cache, p.x, p.y, p.z);
+    if (!cache->chunk || (GetComponentType(block) != node->type)) {
+        RemoveNode(index);
+        return 0;
+    }
+
+    int power = 0;
+    switch (node->type) {
+        case NODE_WIRE:
+            if (node->net < 0) CompileNet(index);
+            return EvaluateNet(world, cache, nodes[index].net);
+        case NODE_TORCH: {
+            int below = node->neighbors[DIRECTION_DOWN];
+            bool powered = (below >= 0) && (GetOutputTowards(&nodes[below], DIRECTION_UP) > 0);
+            power = powered? 0 : REDSTONE_MAX_POWER;
+        } break;
+        case NODE_LEVER:
+            power = (GetBlockDataCached(world, cache, p.x, p.y, p.z) & REDSTONE_POWERED)? REDSTONE_MAX_POWER : 0;
+            break;
+        case NODE_POWER_BLOCK:
+            power = REDSTONE_MAX_POWER;
+            break;
+        case NODE_LAMP:
+            for (int d = 0; (d < 6) && (power == 0); d++) {
+                int neighbor = node->neighbors[d];
+                if ((neighbor >= 0) && (GetOutputTowards(&nodes[neighbor], d ^ 1) > 0)) power = 1;
+            }
+            break;
+        default: break;
+    }
+
+    bool changed = (power != node->power);
+    node->power = (unsigned char)power;
+    SyncBlockData(world, cache, node, block);
+
+    if (!changed) return 0;
+    if (node->type != NODE_LAMP) ScheduleNeighbors(index);
+    return 1;
+}
+
+//----------------------------------------------------------------------------------
+// Redstone Functions
+//----------------------------------------------------------------------------------
+void InitRedstone(void) {
+    nodesUsed = 0;
+    liveNodes = 0;
+    freeNodes.count = 0;
+    ClearBlockPosSet(&nodeMap);
+
+    for (int i = 0; i < netsUsed; i++) nets[i].wires.count = 0;
+    netsUsed = 0;
+    liveNets = 0;
+    freeNets.count = 0;
+
+    for (int i = 0; i < EVENT_WHEEL_SIZE; i++) eventWheel[i].count = 0;
+    currentTick = 0;
+    stats = (RedstoneStats){0};
+}
+
+void UnloadRedstone(void) {
+    for (int i = 0; i < netCapacity; i++) FreeIndexList(&nets[i].wires);
+    free(nets);
+    nets = NULL;
+    netCapacity = netsUsed = liveNets = 0;
+    FreeIndexList(&freeNets);
+
+    free(nodes);
+    nodes = NULL;
+    nodeCapacity = nodesUsed = liveNodes = 0;
+    FreeIndexList(&freeNodes);
+    UnloadBlockPosSet(&nodeMap);
+
+    for (int i = 0; i < EVENT_WHEEL_SIZE; i++) FreeIndexList(&eventWheel[i]);
+    for (int i = 0; i <= REDSTONE_MAX_POWER; i++) FreeIndexList(&levelBuckets[i]);
+    stats = (RedstoneStats){0};
+}
+
+void UpdateRedstone(VoxelWorld* world) {
+    double startTime = GetTime();
+    BlockLookupCache cache = { 0 };
+
+    // Zero delay events are appended to the bucket being drained and run this tick
+    IndexList* bucket = &eventWheel[currentTick & (EVENT_WHEEL_SIZE - 1)];
+    int processed = 0;
+    int changes = 0;
+    int next = 0;
+
+    for (; (next < bucket->count) && (processed < REDSTONE_MAX_EVENTS_PER_TICK); next++) {
+        int index = bucket->items[next];
+        RedstoneNode* node = &nodes[index];
+
+        node->queued = false;
+        if ((node->type == NODE_WIRE) && (node->net >= 0)) nets[node->net].queued = false;
+        if (node->type == NODE_FREE) continue;      // Removed while queued
+
+        changes += EvaluateNode(world, &cache, index);
+        processed++;
+    }
+
+    // Events left behind by the cap run first next tick
+    int deferred = bucket->count - next;
+    IndexList* following = &eventWheel[(currentTick + 1) & (EVENT_WHEEL_SIZE - 1)];
+    for (int i = next; i < bucket->count; i++) PushIndex(following, bucket->items[i]);
+    bucket->count = 0;
+    currentTick++;
+
+    stats.nodeCount = liveNodes;
+    stats.netCount = liveNets;
+    stats.eventsProcessed = processed;
+    stats.eventsDeferred = deferred;
+    stats.stateChanges = changes;
+    stats.updateTime = (float)((GetTime() - startTime)*1000.0);
+}
+
+void OnRedstoneBlockChanged(VoxelWorld* world, BlockPos position) {
+    RedstoneNodeType type = GetComponentType(GetBlock(world, position));
+    int index = GetBlockPosValue(&nodeMap, position, -1);
+
+    if ((index >= 0) && (nodes[index].type == type)) {
+        ScheduleInput(index);
+        return;
+    }
+
+    if (index >= 0) RemoveNode(index);
+    if (type != NODE_FREE) AddNode(position, type, GetBlockData(world, position));
+}
+
+bool ToggleLever(VoxelWorld* world, BlockPos position) {
+    if (GetBlock(world, position) != BLOCK_LEVER) return false;
+
+    SetBlockWithData(world, position, BLOCK_LEVER, GetBlockData(world, position) ^ REDSTONE_POWERED);
+    OnRedstoneBlockChanged(world, position);
+    return true;
+}
+
+void BuildRedstoneBenchmark(VoxelWorld* world, Vector3 origin) {
+    // Rows of torch clocks, each driving a wire run with a lamp beside every wire, stacked in layers
+    const int layerHeight = 4;
+    const int width = 2 + BENCHMARK_LINE_LENGTH;
+    const int depth = REDSTONE_BENCHMARK_ROWS*2;
+
+    int baseX = (int)floorf(origin.x) + 3;
+    int baseZ = (int)floorf(origin.z) - depth/2;
+    int baseY = (int)floorf(origin.y);
+    if (baseY + REDSTONE_BENCHMARK_LAYERS*layerHeight >= WORLD_HEIGHT) baseY = WORLD_HEIGHT - 1 - REDSTONE_BENCHMARK_LAYERS*layerHeight;
+    if (baseY < 1) baseY = 1;
+
+    int before = liveNodes;
+
+    for (int layer = 0; layer < REDSTONE_BENCHMARK_LAYERS; layer++) {
+        int y = baseY + layer*layerHeight;
+
+        // Clear the layer and lay its floor
+        for (int x = 0; x < width; x++) {
+            for (int z = 0; z < depth; z++) {
+                SetBlock(world, (BlockPos){ baseX + x, y - 1, baseZ + z }, BLOCK_STONE);
+                for (int dy = 0; dy < layerHeight - 1; dy++) SetBlock(world, (BlockPos){ baseX + x, y + dy, baseZ + z }, BLOCK_AIR);
+            }
+        }
+
+        for (int row = 0; row < REDSTONE_BENCHMARK_ROWS; row++) {
+            int z = baseZ + row*2;
+
+            // Clock: the torch powers the wire loop it stands on, which turns it off again
+            BlockPos clock[4] = {
+                { baseX, y, z },                // Torch input
+                { baseX, y + 1, z },            // Torch
+                { baseX + 1, y + 1, z },        // Torch output
+                { baseX + 1, y, z }             // Back down to the line
+            };
+            SetBlockWithData(world, clock[0], BLOCK_REDSTONE_WIRE, 0);
+            SetBlockWithData(world, clock[1], BLOCK_REDSTONE_TORCH, REDSTONE_POWERED);
+            SetBlockWithData(world, clock[2], BLOCK_REDSTONE_WIRE, 0);
+            SetBlockWithData(world, clock[3], BLOCK_REDSTONE_WIRE, 0);
+            for (int i = 0; i < 4; i++) OnRedstoneBlockChanged(world, clock[i]);
+
+            for (int x = 2; x < width; x++) {
+                BlockPos wire = { baseX + x, y, z };
+                BlockPos lamp = { baseX + x, y, z + 1 };
+                SetBlock(world, wire, BLOCK_REDSTONE_WIRE);
+                SetBlock(world, lamp, BLOCK_REDSTONE_LAMP);
+                OnRedstoneBlockChanged(world, wire);
+                OnRedstoneBlockChanged(world, lamp);
+            }
+        }
+    }
+
+    printf("Redstone benchmark: built %d components (%d torch clocks), see HUD for update cost\n",
+           liveNodes - before, REDSTONE_BENCHMARK_LAYERS*REDSTONE_BENCHMARK_ROWS);
+}
+
+RedstoneStats GetRedstoneStats(void) {
+    return stats;
+}
@@ -0,0 +1,47 @@
+#ifndef REDSTONE_H
+#define REDSTONE_H
+
+#include "voxel_types.h"
+#include "voxel_world.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Redstone Constants
+//----------------------------------------------------------------------------------
+#define REDSTONE_MAX_POWER              15      // Source power, wires lose one level per block
+#define REDSTONE_TORCH_DELAY            2       // Ticks between a torch input change and its output flip
+#define REDSTONE_MAX_EVENTS_PER_TICK    65536   // Component evaluations per tick, the rest waits
+#define REDSTONE_BENCHMARK_ROWS         32      // Clock rows per layer of the benchmark circuit
+#define REDSTONE_BENCHMARK_LAYERS       3
+
+// Block data of redstone components
+#define REDSTONE_POWERED                0x01    // Wire powered, torch or lamp lit, lever on
+
+typedef struct {
+    int nodeCount;              // Components in the compiled graph
+    int netCount;               // Compiled wire nets
+    int eventsProcessed;        // Component evaluations run in the last tick
+    int eventsDeferred;         // Evaluations pushed to the next tick by the per-tick cap
+    int stateChanges;           // Components whose output changed in the last tick
+    float updateTime;           // Milliseconds spent in the last UpdateRedstone() call
+} RedstoneStats;
+
+//----------------------------------------------------------------------------------
+// Redstone Functions (simulation thread)
+//----------------------------------------------------------------------------------
+void InitRedstone(void);                                                // Also drops the compiled graph
+void UnloadRedstone(void);
+void UpdateRedstone(VoxelWorld* world);                                 // Called once per simulation tick
+void OnRedstoneBlockChanged(VoxelWorld* world, BlockPos position);      // Recompile the graph around a changed block
+bool ToggleLever(VoxelWorld* world, BlockPos position);                 // Returns false if there is no lever
+void BuildRedstoneBenchmark(VoxelWorld* world, Vector3 origin);         // Torch clocks driving wires and lamps
+RedstoneStats GetRedstoneStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REDSTONE_H
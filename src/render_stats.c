@@ -0,0 +1,155 @@
+#include "render_stats.h"
+#include <stdio.h>
+#include <string.h>
+
+/*
+---------------------------------------------------------------------------------
+Render Statistics
+
+Per-frame counters describing render load: draw calls, submitted geometry per pass,
+chunk culling results, mesh rebuilds, GPU upload volume and work queue depths.
+Counters accumulate during a frame and are latched by BeginRenderStatsFrame(), so the
+HUD always shows a complete frame. Latched frames are also kept in a ring buffer that
+can be exported as CSV for offline profiling.
+
+---------------------------------------------------------------------------------
+*/
+
+//----------------------------------------------------------------------------------
+// Local Variables
+//----------------------------------------------------------------------------------
+static RenderStats currentStats = {0};
+static RenderStats lastStats = {0};
+static RenderStats statsHistory[RENDER_STATS_HISTORY] = {0};
+static int historyIndex = 0;
+static int historyCount = 0;
+
+//----------------------------------------------------------------------------------
+// Render Statistics Functions
+//----------------------------------------------------------------------------------
+void BeginRenderStatsFrame(void) {
+    // Latch counters accumulated during the previous frame
+    currentStats.frameTime = GetFrameTime()*1000.0f;
+    lastStats = currentStats;
+
+    statsHistory[historyIndex] = lastStats;
+    historyIndex = (historyIndex + 1) % RENDER_STATS_HISTORY;
+    if (historyCount < RENDER_STATS_HISTORY) historyCount++;
+
+    memset(&currentStats, 0, sizeof(currentStats));
+}
+
+RenderStats GetRenderStats(void) {
+    return lastStats;
+}
+
+void RenderStatsAddDrawCall(RenderPass pass, int vertexCount, int triangleCount) {
+    currentStats.drawCalls++;
+    currentStats.vertices[pass] += vertexCount;
+    currentStats.triangles[pass] += triangleCount;
+}
+
+void RenderStatsAddChunkCulled(bool occlusion) {
+    if (occlusion) currentStats.chunksOcclusionCulled++;
+    else currentStats.chunksFrustumCulled++;
+}
+
+void RenderStatsAddChunkDrawn(void) {
+    currentStats.chunksDrawn++;
+}
+
+void RenderStatsAddMeshRebuilt(int bytesUploaded) {
+    currentStats.meshesRebuilt++;
+    currentStats.bytesUploaded += bytesUploaded;
+}
+
+void RenderStatsSetQueueDepths(int generationQueue, int meshingQueue) {
+    currentStats.generationQueueDepth = generationQueue;
+    currentStats.meshingQueueDepth = meshingQueue;
+}
+
+void RenderStatsMerge(const RenderStats* stats) {
+    currentStats.drawCalls += stats->drawCalls;
+    for (int pass = 0; pass < RENDER_PASS_COUNT; pass++) {
+        currentStats.vertices[pass] += stats->vertices[pass];
+        currentStats.triangles[pass] += stats->triangles[pass];
+    }
+    currentStats.chunksFrustumCulled += stats->chunksFrustumCulled;
+    currentStats.chunksOcclusionCulled += stats->chunksOcclusionCulled;
+    currentStats.chunksDrawn += stats->chunksDrawn;
+    currentStats.meshesRebuilt += stats->meshesRebuilt;
+    currentStats.bytesUploaded += stats->bytesUploaded;
+    currentStats.generationQueueDepth += stats->generationQueueDepth;
+    currentStats.meshingQueueDepth += stats->meshingQueueDepth;
+    currentStats.jobsCancelled += stats->jobsCancelled;
+    currentStats.staleMeshesDropped += stats->staleMeshesDropped;
+}
+
+//----------------------------------------------------------------------------------
+// Debug HUD and Profiler Export
+//----------------------------------------------------------------------------------
+void DrawRenderStats(int posX, int posY) {
+    RenderStats stats = lastStats;
+    int panelWidth = 300;
+    int panelHeight = 210;
+
+    DrawRectangle(posX, posY, panelWidth, panelHeight, (Color){0, 0, 0, 150});
+    DrawRectangleLines(posX, posY, panelWidth, panelHeight, WHITE);
+
+    DrawText("Render Stats", posX + 10, posY + 10, 18, YELLOW);
+    DrawText(TextFormat("Frame: %.2f ms | Draw calls: %d", stats.frameTime, stats.drawCalls),
+             posX + 10, posY + 35, 14, WHITE);
+    DrawText(TextFormat("Opaque: %d verts, %d tris",
+             stats.vertices[RENDER_PASS_OPAQUE], stats.triangles[RENDER_PASS_OPAQUE]),
+             posX + 10, posY + 55, 14, WHITE);
+    DrawText(TextFormat("Transparent: %d verts, %d tris",
+             stats.vertices[RENDER_PASS_TRANSPARENT], stats.triangles[RENDER_PASS_TRANSPARENT]),
+             posX + 10, posY + 75, 14, WHITE);
+    DrawText(TextFormat("Liquid: %d verts, %d tris",
+             stats.vertices[RENDER_PASS_LIQUID], stats.triangles[RENDER_PASS_LIQUID]),
+             posX + 10, posY + 95, 14, WHITE);
+    DrawText(TextFormat("Chunks drawn: %d", stats.chunksDrawn), posX + 10, posY + 115, 14, WHITE);
+    DrawText(TextFormat("Culled: %d frustum, %d occlusion",
+             stats.chunksFrustumCulled, stats.chunksOcclusionCulled),
+             posX + 10, posY + 135, 14, LIGHTGRAY);
+    DrawText(TextFormat("Meshes rebuilt: %d (%.1f KB uploaded)",
+             stats.meshesRebuilt, stats.bytesUploaded/1024.0f),
+             posX + 10, posY + 155, 14, LIGHTGRAY);
+    DrawText(TextFormat("Queues: %d generation, %d meshing",
+             stats.generationQueueDepth, stats.meshingQueueDepth),
+             posX + 10, posY + 175, 14, LIGHTGRAY);
+    DrawText(TextFormat("Jobs: %d cancelled, %d stale meshes dropped",
+             stats.jobsCancelled, stats.staleMeshesDropped),
+             posX + 10, posY + 195, 14, LIGHTGRAY);
+}
+
+bool ExportRenderStats(const char* fileName) {
+    FILE* file = fopen(fileName, "w");
+    if (!file) {
+        printf("Error: Cannot open render stats export file: %s\n", fileName);
+        return false;
+    }
+
+    fprintf(file, "frame,frameTimeMs,drawCalls,opaqueVertices,opaqueTriangles,"
+                  "transparentVertices,transparentTriangles,liquidVertices,liquidTriangles,chunksFrustumCulled,"
+                  "chunksOcclusionCulled,chunksDrawn,meshesRebuilt,bytesUploaded,"
+                  "generationQueueDepth,meshingQueueDepth,jobsCancelled,staleMeshesDropped\n");
+
+    // Oldest frame first
+    int start = (historyIndex - historyCount + RENDER_STATS_HISTORY) % RENDER_STATS_HISTORY;
+    for (int i = 0; i < historyCount; i++) {
+        const RenderStats* stats = &statsHistory[(start + i) % RENDER_STATS_HISTORY];
+        fprintf(file, "%d,%.3f,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d\n", i, stats->frameTime, stats->drawCalls,
+                stats->vertices[RENDER_PASS_OPAQUE], stats->triangles[RENDER_PASS_OPAQUE],
+                stats->vertices[RENDER_PASS_TRANSPARENT], stats->triangles[RENDER_PASS_TRANSPARENT],
+                stats->vertices[RENDER_PASS_LIQUID], stats->triangles[RENDER_PASS_LIQUID],
+                stats->chunksFrustumCulled, stats->chunksOcclusionCulled, stats->chunksDrawn,
+                stats->meshesRebuilt, stats->bytesUploaded,
+                stats->generationQueueDepth, stats->meshingQueueDepth,
+                stats->jobsCancelled, stats->staleMeshesDropped);
+    }
+
+    fclose(file);
+    printf("Render stats exported: %d frames to %s\n", historyCount, fileName);
+    return true;
+}
@@ -0,0 +1,65 @@
+#ifndef RENDER_STATS_H
+#define RENDER_STATS_H
+
+#include "raylib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Render Statistics Constants
+//----------------------------------------------------------------------------------
+#define RENDER_STATS_HISTORY 600    // Frames kept for profiler export (~10 seconds at 60 FPS)
+
+// Render passes tracked separately
+typedef enum {
+    RENDER_PASS_OPAQUE = 0,
+    RENDER_PASS_TRANSPARENT,
+    RENDER_PASS_LIQUID,
+    RENDER_PASS_COUNT
+} RenderPass;
+
+//----------------------------------------------------------------------------------
+// Render Statistics Structure
+// NOTE: Plain integer counters, cheap enough to stay enabled in release builds
+//----------------------------------------------------------------------------------
+typedef struct {
+    int drawCalls;                          // Draw calls issued for world geometry
+    int vertices[RENDER_PASS_COUNT];        // Vertices submitted per pass
+    int triangles[RENDER_PASS_COUNT];       // Triangles submitted per pass
+    int chunksFrustumCulled;                // Loaded chunks rejected by frustum test
+    int chunksOcclusionCulled;              // Loaded chunks rejected by occlusion test
+    int chunksDrawn;                        // Chunks with at least one draw call
+    int meshesRebuilt;                      // Chunk meshes regenerated this frame
+    int bytesUploaded;                      // Vertex/index bytes sent to the GPU
+    int generationQueueDepth;               // Chunks waiting for terrain generation
+    int meshingQueueDepth;                  // Chunks waiting for a mesh rebuild
+    int jobsCancelled;                      // Queued generation/mesh jobs cancelled by unloads
+    int staleMeshesDropped;                 // Mesh results discarded for outdated chunk content
+    float frameTime;                        // Frame time in milliseconds
+} RenderStats;
+
+//----------------------------------------------------------------------------------
+// Render Statistics Functions
+//----------------------------------------------------------------------------------
+void BeginRenderStatsFrame(void);           // Close previous frame counters and reset current ones
+RenderStats GetRenderStats(void);           // Get last completed frame counters
+
+// Counter updates (called by renderer and world systems)
+void RenderStatsAddDrawCall(RenderPass pass, int vertexCount, int triangleCount);
+void RenderStatsAddChunkCulled(bool occlusion);
+void RenderStatsAddChunkDrawn(void);
+void RenderStatsAddMeshRebuilt(int bytesUploaded);
+void RenderStatsSetQueueDepths(int generationQueue, int meshingQueue);
+void RenderStatsMerge(const RenderStats* stats);   // Add counters gathered on another thread
+
+// Debug HUD and profiler export
+void DrawRenderStats(int posX, int posY);
+bool ExportRenderStats(const char* fileName);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RENDER_STATS_H
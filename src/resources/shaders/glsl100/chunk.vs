@@ -0,0 +1,40 @@
+#version 100
+
+// Input vertex attributes
+attribute vec3 vertexPosition;
+attribute vec2 vertexTexCoord;  // Atlas u plus animation id*animationStride, atlas v
+attribute vec2 vertexTexCoord2; // Sky and block light (level/15)
+attribute vec4 vertexColor;     // rgb biome tint, a ambient occlusion
+
+// Input uniform values
+uniform mat4 mvp;
+uniform vec4 animations[8];     // Per animation id: first atlas slot, frame count, ticks per frame, slots per atlas row
+uniform float animationTicks;   // Simulation ticks, frame clock of animated textures
+
+// Output vertex attributes (to fragment shader)
+varying vec2 fragTexCoord;
+varying vec2 fragLight;
+varying vec4 fragColor;
+
+// Same as TEXTURE_ANIMATION_STRIDE in voxel_renderer.c
+const float animationStride = 32.0;
+
+void main()
+{
+    // Animation id folded into u (biased so u = 0 never rounds down into the previous id),
+    // every vertex of a face moves by the same whole slot offset
+    float id = floor(vertexTexCoord.x/animationStride + 0.25);
+    vec4 animation = animations[int(id)];
+    float frame = floor(mod(floor(animationTicks/animation.z) + 0.5, animation.y));
+    float first = animation.x;
+    float current = first + frame;
+    float firstRow = floor((first + 0.5)/animation.w);
+    float currentRow = floor((current + 0.5)/animation.w);
+    vec2 offset = vec2((current - currentRow*animation.w) - (first - firstRow*animation.w), currentRow - firstRow)/animation.w;
+
+    fragTexCoord = vec2(vertexTexCoord.x - id*animationStride, vertexTexCoord.y) + offset;
+    fragLight = vertexTexCoord2;
+    fragColor = vertexColor;
+
+    gl_Position = mvp*vec4(vertexPosition, 1.0);
+}
@@ -0,0 +1,19 @@
+#version 100
+
+precision mediump float;
+
+// Input vertex attributes (from vertex shader)
+varying vec2 fragTexCoord;
+varying float fragShade;
+
+// Input uniform values
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+
+void main()
+{
+    vec4 texelColor = texture2D(texture0, fragTexCoord);
+    if (texelColor.a < 0.1) discard;
+
+    gl_FragColor = vec4(texelColor.rgb*fragShade, texelColor.a)*colDiffuse;
+}
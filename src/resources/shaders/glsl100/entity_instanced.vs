@@ -0,0 +1,27 @@
+#version 100
+
+// Input vertex attributes
+attribute vec3 vertexPosition;
+attribute vec2 vertexTexCoord;
+attribute vec3 vertexNormal;
+
+// Per-instance model matrix (one entity)
+attribute mat4 instanceTransform;
+
+// Input uniform values
+uniform mat4 mvp;
+
+// Output vertex attributes (to fragment shader)
+varying vec2 fragTexCoord;
+varying float fragShade;
+
+void main()
+{
+    vec3 normal = normalize(mat3(instanceTransform[0].xyz, instanceTransform[1].xyz, instanceTransform[2].xyz)*vertexNormal);
+
+    // Fixed sun direction, tops bright and sides darker like the block faces
+    fragShade = 0.6 + 0.4*max(dot(normal, normalize(vec3(0.3, 1.0, 0.5))), 0.0);
+    fragTexCoord = vertexTexCoord;
+
+    gl_Position = mvp*instanceTransform*vec4(vertexPosition, 1.0);
+}
@@ -0,0 +1,22 @@
+#version 100
+
+precision mediump float;
+
+// Input vertex attributes (from vertex shader)
+varying vec2 fragTexCoord;
+varying vec4 fragColor;
+varying float fragTexture;
+
+// Input uniform values
+uniform sampler2D texture0;     // Block atlas
+uniform sampler2D texture1;     // Particle sheet
+
+void main()
+{
+    vec4 texelColor = (fragTexture < 0.5)? texture2D(texture0, fragTexCoord) : texture2D(texture1, fragTexCoord);
+
+    // Cutout, particles are drawn without sorting
+    if (texelColor.a < 0.5) discard;
+
+    gl_FragColor = texelColor*fragColor;
+}
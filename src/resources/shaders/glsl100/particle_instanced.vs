@@ -0,0 +1,34 @@
+#version 100
+
+// Input vertex attributes (unit quad corner in xy)
+attribute vec3 vertexPosition;
+attribute vec2 vertexTexCoord;
+
+// Per-instance particle data packed in a matrix:
+// [0] position + size, [1] uv rect, [2] tint, [3].x texture (0 = block atlas, 1 = particle sheet)
+attribute mat4 instanceTransform;
+
+// Input uniform values
+uniform mat4 mvp;
+uniform vec3 cameraRight;
+uniform vec3 cameraUp;
+
+// Output vertex attributes (to fragment shader)
+varying vec2 fragTexCoord;
+varying vec4 fragColor;
+varying float fragTexture;
+
+void main()
+{
+    vec4 center = instanceTransform[0];
+    vec4 uvRect = instanceTransform[1];
+
+    // Camera facing billboard
+    vec3 position = center.xyz + (cameraRight*vertexPosition.x + cameraUp*vertexPosition.y)*center.w;
+
+    fragTexCoord = uvRect.xy + vertexTexCoord*uvRect.zw;
+    fragColor = instanceTransform[2];
+    fragTexture = instanceTransform[3].x;
+
+    gl_Position = mvp*vec4(position, 1.0);
+}
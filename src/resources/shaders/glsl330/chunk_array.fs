@@ -0,0 +1,27 @@
+#version 330
+
+// Input vertex attributes (from vertex shader)
+in vec3 fragTexCoord;
+in vec2 fragLight;
+in vec4 fragColor;
+
+// Input uniform values
+uniform sampler2DArray blockTextures;   // One mipmapped layer per block texture
+uniform sampler2D texture1;     // Lightmap 16x32: rows 0-15 sky light, rows 16-31 block light
+uniform vec4 colDiffuse;
+uniform float daylight;         // Sun brightness, lightmap column of the sky rows (0 night, 1 day)
+
+// Output fragment color
+out vec4 finalColor;
+
+void main()
+{
+    vec4 texelColor = texture(blockTextures, fragTexCoord);
+
+    // Texel centers of the row for each light level, the filter blends between levels
+    vec3 skyLight = texture(texture1, vec2((0.5 + daylight*15.0)/16.0, (0.5 + fragLight.x*15.0)/32.0)).rgb;
+    vec3 blockLight = texture(texture1, vec2(15.5/16.0, (16.5 + fragLight.y*15.0)/32.0)).rgb;
+    vec3 light = min(skyLight + blockLight, vec3(1.0))*fragColor.a;
+
+    finalColor = vec4(texelColor.rgb*fragColor.rgb*light, texelColor.a)*colDiffuse;
+}
@@ -0,0 +1,37 @@
+#version 330
+
+// Input vertex attributes
+in vec3 vertexPosition;
+in vec2 vertexTexCoord;         // Tile u plus animation id*animationStride, tile v plus layer*layerStride
+in vec2 vertexTexCoord2;        // Sky and block light (level/15)
+in vec4 vertexColor;            // rgb biome tint, a ambient occlusion
+
+// Input uniform values
+uniform mat4 mvp;
+uniform vec4 animations[8];     // Per animation id: first layer, frame count, ticks per frame, unused
+uniform float animationTicks;   // Simulation ticks, frame clock of animated textures
+
+// Output vertex attributes (to fragment shader)
+out vec3 fragTexCoord;          // Tile u, tile v, array layer
+out vec2 fragLight;
+out vec4 fragColor;
+
+// Same as TEXTURE_LAYER_STRIDE and TEXTURE_ANIMATION_STRIDE in voxel_renderer.c
+const float layerStride = 32.0;
+const float animationStride = 32.0;
+
+void main()
+{
+    // Decoded per vertex: every vertex of a face carries the same layer, only the tile coords interpolate
+    // NOTE: Biased by a quarter stride so a tile coord of 0 never rounds down into the previous layer or id
+    float layer = floor(vertexTexCoord.y/layerStride + 0.25);
+    float id = floor(vertexTexCoord.x/animationStride + 0.25);
+    vec4 animation = animations[int(id)];
+    float frame = floor(mod(floor(animationTicks/animation.z) + 0.5, animation.y));
+
+    fragTexCoord = vec3(vertexTexCoord.x - id*animationStride, vertexTexCoord.y - layer*layerStride, layer + frame);
+    fragLight = vertexTexCoord2;
+    fragColor = vertexColor;
+
+    gl_Position = mvp*vec4(vertexPosition, 1.0);
+}
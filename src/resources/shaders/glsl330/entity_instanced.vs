@@ -0,0 +1,27 @@
+#version 330
+
+// Input vertex attributes
+in vec3 vertexPosition;
+in vec2 vertexTexCoord;
+in vec3 vertexNormal;
+
+// Per-instance model matrix (one entity)
+in mat4 instanceTransform;
+
+// Input uniform values
+uniform mat4 mvp;
+
+// Output vertex attributes (to fragment shader)
+out vec2 fragTexCoord;
+out float fragShade;
+
+void main()
+{
+    vec3 normal = normalize(mat3(instanceTransform)*vertexNormal);
+
+    // Fixed sun direction, tops bright and sides darker like the block faces
+    fragShade = 0.6 + 0.4*max(dot(normal, normalize(vec3(0.3, 1.0, 0.5))), 0.0);
+    fragTexCoord = vertexTexCoord;
+
+    gl_Position = mvp*instanceTransform*vec4(vertexPosition, 1.0);
+}
@@ -0,0 +1,38 @@
+#version 330
+
+// Input vertex attributes (from vertex shader)
+in vec2 fragTexCoord;
+in vec3 fragSlot;
+in vec2 fragLight;
+in vec4 fragColor;
+
+// Input uniform values
+uniform sampler2D texture0;     // Block atlas
+uniform sampler2D texture1;     // Lightmap 16x32: rows 0-15 sky light, rows 16-31 block light
+uniform vec4 colDiffuse;
+uniform float daylight;         // Sun brightness, lightmap column of the sky rows (0 night, 1 day)
+
+// Output fragment color
+out vec4 finalColor;
+
+// Color and opacity deep water fades to
+const vec3 deepColor = vec3(0.05, 0.16, 0.34);
+const float deepAlpha = 0.92;
+
+void main()
+{
+    // Tile coords wrap inside the slot, the atlas is point sampled so nothing bleeds in from its neighbors
+    vec4 texelColor = texture(texture0, fragSlot.xy + fract(fragTexCoord)*fragSlot.z);
+
+    // Texel centers of the row for each light level, the filter blends between levels
+    vec3 skyLight = texture(texture1, vec2((0.5 + daylight*15.0)/16.0, (0.5 + fragLight.x*15.0)/32.0)).rgb;
+    vec3 blockLight = texture(texture1, vec2(15.5/16.0, (16.5 + fragLight.y*15.0)/32.0)).rgb;
+    vec3 light = min(skyLight + blockLight, vec3(1.0));
+
+    // Deeper water darkens and hides more of the floor, shallow water keeps the texture
+    float depth = fragColor.a;
+    vec3 color = mix(texelColor.rgb*fragColor.rgb, deepColor, depth*0.7);
+    float alpha = mix(texelColor.a, deepAlpha, depth);
+
+    finalColor = vec4(color*light, alpha)*colDiffuse;
+}
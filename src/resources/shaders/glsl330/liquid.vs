@@ -0,0 +1,45 @@
+#version 330
+
+// Input vertex attributes
+in vec3 vertexPosition;
+in vec2 vertexTexCoord;         // Tile u plus animation id*animationStride, tile v plus atlas slot*slotStride
+in vec2 vertexTexCoord2;        // Sky and block light (level/15)
+in vec4 vertexColor;            // rgb tint, a liquid depth under the surface (0 to 1)
+
+// Input uniform values
+uniform mat4 mvp;
+uniform vec4 animations[8];     // Per animation id: first atlas slot, frame count, ticks per frame, slots per atlas row
+uniform float animationTicks;   // Simulation ticks, frame clock of animated textures and of the flow
+
+// Output vertex attributes (to fragment shader)
+out vec2 fragTexCoord;          // Scrolled tile coords, merged faces span several tiles
+out vec3 fragSlot;              // Atlas slot of the current frame: origin and size
+out vec2 fragLight;
+out vec4 fragColor;
+
+// Same as TEXTURE_LAYER_STRIDE and TEXTURE_ANIMATION_STRIDE in voxel_renderer.c
+const float slotStride = 32.0;
+const float animationStride = 32.0;
+
+// Tiles the texture drifts per tick, a whole number of tiles per day so the daily tick wrap does not jump
+const float flowSpeed = 1.0/96.0;
+
+void main()
+{
+    // Decoded per vertex as in chunk_array.vs, biased so a tile coord of 0 never rounds down
+    float slot = floor(vertexTexCoord.y/slotStride + 0.25);
+    float id = floor(vertexTexCoord.x/animationStride + 0.25);
+    vec4 animation = animations[int(id)];
+    float frame = floor(mod(floor(animationTicks/animation.z) + 0.5, animation.y));
+    float current = slot + frame;
+    float row = floor((current + 0.5)/animation.w);
+
+    // Side faces run v from top to bottom, so the drift reads as water pouring down them
+    float flow = fract(animationTicks*flowSpeed);
+    fragTexCoord = vec2(vertexTexCoord.x - id*animationStride, vertexTexCoord.y - slot*slotStride - flow);
+    fragSlot = vec3(current - row*animation.w, row, 1.0)/animation.w;
+    fragLight = vertexTexCoord2;
+    fragColor = vertexColor;
+
+    gl_Position = mvp*vec4(vertexPosition, 1.0);
+}
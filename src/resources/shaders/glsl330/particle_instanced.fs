@@ -0,0 +1,23 @@
+#version 330
+
+// Input vertex attributes (from vertex shader)
+in vec2 fragTexCoord;
+in vec4 fragColor;
+in float fragTexture;
+
+// Input uniform values
+uniform sampler2D texture0;     // Block atlas
+uniform sampler2D texture1;     // Particle sheet
+
+// Output fragment color
+out vec4 finalColor;
+
+void main()
+{
+    vec4 texelColor = (fragTexture < 0.5)? texture(texture0, fragTexCoord) : texture(texture1, fragTexCoord);
+
+    // Cutout, particles are drawn without sorting
+    if (texelColor.a < 0.5) discard;
+
+    finalColor = texelColor*fragColor;
+}
@@ -0,0 +1,34 @@
+#version 330
+
+// Input vertex attributes (unit quad corner in xy)
+in vec3 vertexPosition;
+in vec2 vertexTexCoord;
+
+// Per-instance particle data packed in a matrix:
+// [0] position + size, [1] uv rect, [2] tint, [3].x texture (0 = block atlas, 1 = particle sheet)
+in mat4 instanceTransform;
+
+// Input uniform values
+uniform mat4 mvp;
+uniform vec3 cameraRight;
+uniform vec3 cameraUp;
+
+// Output vertex attributes (to fragment shader)
+out vec2 fragTexCoord;
+out vec4 fragColor;
+out float fragTexture;
+
+void main()
+{
+    vec4 center = instanceTransform[0];
+    vec4 uvRect = instanceTransform[1];
+
+    // Camera facing billboard
+    vec3 position = center.xyz + (cameraRight*vertexPosition.x + cameraUp*vertexPosition.y)*center.w;
+
+    fragTexCoord = uvRect.xy + vertexTexCoord*uvRect.zw;
+    fragColor = instanceTransform[2];
+    fragTexture = instanceTransform[3].x;
+
+    gl_Position = mvp*vec4(position, 1.0);
+}
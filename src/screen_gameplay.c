@@ -22,7 +22,41 @@
 #include "voxel_renderer.h"
 #include "world_generation.h"
 #include "player.h"
+#include "render_stats.h"
+#include "platform_threads.h"
+#include "job_system.h"
+#include "frame_scheduler.h"
+#include "entity_system.h"
+#include "entity_renderer.h"
+#include "particle_system.h"
+#include "particle_renderer.h"
+#include "fluid_system.h"
+#include "block_ticks.h"
+#include "redstone.h"
+#include "world_lighting.h"
 #include <stdio.h>
+#include <string.h>
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Immutable per-frame snapshot produced by the simulation thread for the render thread
+typedef struct {
+    RenderPacket render;            // Draw list and GPU commands for the voxel world
+    EntityRenderList entities;      // Interpolated entity transforms grouped by type
+    ParticleRenderList particles;   // Packed particle instances
+    FluidStats fluids;
+    BlockTickStats blockTicks;
+    RedstoneStats redstone;
+    LightingStats lighting;
+    float timeOfDay;                // World time of day, 0 midnight to 1
+    Player player;                  // Player copy for camera, hotbar and inventory UI
+    ChunkPos playerChunk;
+    int chunkCount;
+    bool currentChunkLoaded;
+    BlockType groundBlock;
+    BlockType targetBlockType;
+} GameplayFrame;
 
 //----------------------------------------------------------------------------------
 // Module Variables Definition (local)
@@ -38,12 +72,42 @@ static int pauseMenuItemCount = 2;
 // Voxel game systems
 static VoxelWorld world;
 static Player player;
+static EntityWorld entities;
 static bool gameInitialized = false;
 
+// Fixed-timestep simulation state (owned by the simulation thread while it runs)
+static float tickAccumulator = 0.0f;
+
+// Double-buffered frame snapshots: main thread draws the front one, simulation writes the other
+static GameplayFrame frames[2] = {0};
+static int frontFrame = 0;
+
+// Simulation thread state
+// NOTE: World and player are only touched by the main thread while the simulation is idle
+static Thread* simThread = NULL;
+static Mutex* simMutex = NULL;
+static CondVar* simCondVar = NULL;
+static GameplayFrame* simTarget = NULL;
+static float simFrameTime = 0.0f;
+static bool simRequested = false;
+static bool simFrameReady = false;
+static bool simQuit = false;
+
+// Debug HUD state
+static bool showRenderStats = true;
+static double jobThroughput = 0.0;     // Last job system benchmark result (jobs per second)
+static double mesherTime = 0.0;        // Last mesher benchmark result (milliseconds per section)
+static AtlasCacheTimes atlasTimes = { 0 };  // Last texture atlas cold/warm build benchmark
+
 //----------------------------------------------------------------------------------
 // Local Functions Declaration
 //----------------------------------------------------------------------------------
 static void DrawPauseMenu(void);
+static void SimulateFrame(GameplayFrame* frame, float frameTime);
+static void SimulationThread(void* userData);
+static void KickSimulation(float frameTime);
+static bool WaitForSimulation(void);
+static void DrawSimulationStats(const GameplayFrame* frame, int posX, int posY);
 
 //----------------------------------------------------------------------------------
 // Gameplay Screen Functions Definition
@@ -60,6 +124,8 @@ void InitGameplayScreen(void)
     pauseMenuSelection = 0;
     
     if (!gameInitialized) {
+        double startTime = GetTime();
+        
         // Initialize voxel world
         InitVoxelWorld(&world);
         
@@ -71,12 +137,44 @@ void InitGameplayScreen(void)
         // Load initial chunks near spawn BEFORE player physics start
         // otherwise player will fall through the world forever
         LoadChunksAroundPlayer(&world, startPosition);
+        WaitForChunkGeneration(&world);
+        
+        // A few animals around spawn
+        InitEntityWorld(&entities);
+        SpawnEntitiesAround(&entities, startPosition, 24.0f, 24);
+        InitParticleSystem();
+        InitFluidSystem();
+        InitBlockTicks();
+        InitRedstone();
         
         // Initialize renderer
         InitVoxelRenderer();
+        InitEntityRenderer();
+        InitParticleRenderer();
+        
+        tickAccumulator = 0.0f;
+        memset(frames, 0, sizeof(frames));
+        frontFrame = 0;
+        
+        // Start simulation thread, without thread support simulation runs inline
+        simMutex = LoadMutex();
+        simCondVar = LoadCondVar();
+        simRequested = false;
+        simFrameReady = false;
+        simQuit = false;
+        simThread = StartThread(SimulationThread, NULL);
         
         gameInitialized = true;
+        
+        // Produce the first frame so the first draw has something to show
+        KickSimulation(0.0f);
+        
+        // Title screen to gameplay time: world generation around spawn, texture atlas and renderer setup
+        printf("Gameplay screen ready in %.1f ms\n", (GetTime() - startTime)*1000.0);
     }
+    
+    // Gameplay renders uncapped (paced by vsync), simulation runs on fixed ticks
+    SetTargetFPS(0);
 }
 
 // Gameplay Screen Update logic
@@ -84,6 +182,10 @@ void UpdateGameplayScreen(void)
 {
     framesCounter++;
     
+    // Wait for the frame simulated during the last draw and present it
+    // NOTE: After this point the simulation is idle until KickSimulation()
+    if (WaitForSimulation()) frontFrame = 1 - frontFrame;
+    
     // Handle ESC key for pause menu (only when inventory is not open)
     if (IsKeyPressed(KEY_ESCAPE))
     {
@@ -139,11 +241,19 @@ void UpdateGameplayScreen(void)
     else
     {
         // Normal gameplay updates when not paused
-        // Update world (chunk loading/unloading)
-        UpdateVoxelWorld(&world, player.position);
+        // Sample input once per render frame (mouse look, movement intent, hotbar)
+        HandlePlayerInput(&player);
         
-        // Update player (handles input, physics, interaction)
-        UpdatePlayer(&player, &world);
+        // Render stats panel toggle and profiler export
+        if (IsKeyPressed(KEY_F3)) showRenderStats = !showRenderStats;
+        if (IsKeyPressed(KEY_F4)) ExportRenderStats("render_stats.csv");
+        if (IsKeyPressed(KEY_F5)) jobThroughput = RunJobSystemBenchmark(100000);
+        if (IsKeyPressed(KEY_F6)) RunEntityStressTest(&entities, player.position);
+        if (IsKeyPressed(KEY_F7)) RunParticleStressTest(player.position);
+        if (IsKeyPressed(KEY_F8)) BuildRedstoneBenchmark(&world, player.position);
+        if (IsKeyPressed(KEY_F9)) mesherTime = RunMesherBenchmark(&world);
+        if (IsKeyPressed(KEY_F10)) world.timeOfDay = fmodf(world.timeOfDay + 0.125f, 1.0f);
+        if (IsKeyPressed(KEY_F11)) atlasTimes = RunAtlasCacheBenchmark();
         
         // Exit to menu (alternative method - keeping ENTER as backup)
         if (IsKeyPressed(KEY_ENTER) && IsCursorOnScreen() && !player.inventoryOpen)
@@ -151,24 +261,46 @@ void UpdateGameplayScreen(void)
             finishScreen = 1;
             PlaySound(fxCoin);
         }
+        
+        // Simulate next frame while the current one is drawn
+        KickSimulation(GetFrameTime());
     }
 }
 
 // Gameplay Screen Draw logic
+// NOTE: Reads only the front frame snapshot, the simulation may be writing the other one
 void DrawGameplayScreen(void)
 {
-    // Clear background with sky color
-    ClearBackground((Color){135, 206, 235, 255}); // Sky blue
+    GameplayFrame* frame = &frames[frontFrame];
+    
+    // Latch render counters of the previous frame before submitting this one
+    BeginRenderStatsFrame();
+    
+    // GPU uploads and releases run within the frame task budget, the rest waits for later frames
+    SubmitRenderCommands(&frame->render);
+    RunFrameTasks();
+    
+    // Clear background with sky color, night blue to day sky blue
+    float daylight = frame->render.daylight;
+    ClearBackground((Color){
+        (unsigned char)(10 + (135 - 10)*daylight),
+        (unsigned char)(12 + (206 - 12)*daylight),
+        (unsigned char)(30 + (235 - 30)*daylight),
+        255 });
     
     // 3D rendering
-    BeginMode3D(player.camera);
+    BeginMode3D(frame->render.camera);
     {
+        // Entities first: they write depth before the transparent chunk pass
+        DrawEntities(&frame->entities);
+        DrawParticles(&frame->particles, frame->render.camera);
+        
         // Render the voxel world
-        RenderVoxelWorld(&world, player.camera);
+        RenderVoxelWorld(&frame->render);
         
         // Draw block outline for targeted block
-        if (player.hasTarget && !gamePaused) {
-            DrawBlockOutline(player.targetBlock);
+        if (frame->player.hasTarget && !gamePaused) {
+            DrawBlockOutline(frame->player.targetBlock);
         }
     }
     EndMode3D();
@@ -176,10 +308,10 @@ void DrawGameplayScreen(void)
     // 2D UI rendering
     if (!gamePaused) {
         // Draw inventory UI if inventory is open, otherwise draw normal UI
-        if (player.inventoryOpen) {
-            DrawInventory(&player);
+        if (frame->player.inventoryOpen) {
+            DrawInventory(&frame->player);
         } else {
-            DrawPlayerUI(&player);
+            DrawPlayerUI(&frame->player);
         }
     }
     
@@ -189,44 +321,47 @@ void DrawGameplayScreen(void)
         
         // Position info
         DrawText(TextFormat("Position: (%.1f, %.1f, %.1f)", 
-                 player.position.x, player.position.y, player.position.z), 
+                 frame->player.position.x, frame->player.position.y, frame->player.position.z), 
                  10, 30, 20, WHITE);
         
         // Chunk info
-        ChunkPos playerChunk = WorldToChunk(player.position);
         DrawText(TextFormat("Chunk: (%d, %d) | Loaded Chunks: %d", 
-                 playerChunk.x, playerChunk.z, world.chunkCount), 
+                 frame->playerChunk.x, frame->playerChunk.z, frame->chunkCount), 
                  10, 50, 20, WHITE);
         
         // Debug: Check if current chunk is loaded
-        Chunk* currentChunk = GetChunk(&world, playerChunk);
-        Color chunkStatusColor = currentChunk ? GREEN : RED;
-        DrawText(TextFormat("Current Chunk: %s", currentChunk ? "LOADED" : "NOT LOADED"), 
+        Color chunkStatusColor = frame->currentChunkLoaded ? GREEN : RED;
+        DrawText(TextFormat("Current Chunk: %s", frame->currentChunkLoaded ? "LOADED" : "NOT LOADED"), 
                  10, 70, 20, chunkStatusColor);
         
         // Debug: Check ground block
-        BlockPos groundPos = {(int)player.position.x, (int)(player.position.y - 1), (int)player.position.z};
-        BlockType groundBlock = GetBlock(&world, groundPos);
+        BlockType groundBlock = frame->groundBlock;
         DrawText(TextFormat("Ground Block: %d (%s)", groundBlock, 
                  groundBlock == BLOCK_AIR ? "AIR" : "SOLID"), 
                  10, 90, 20, groundBlock == BLOCK_AIR ? RED : GREEN);
 
         // Always render block debug info, handle null/air targetBlock
-        BlockType targetBlock = GetBlock(&world, player.targetBlock);
+        BlockType targetBlock = frame->targetBlockType;
         const char* blockName = GetBlockName(targetBlock);
         const char* textureName = GetBlockTextureName(targetBlock, FACE_TOP);
 
-        if (player.hasTarget && targetBlock != BLOCK_AIR) {
+        if (frame->player.hasTarget && targetBlock != BLOCK_AIR) {
             DrawText(TextFormat("Target Block: %s", blockName), 10, 110, 20, YELLOW);
             DrawText(TextFormat("Texture: %s.png", textureName), 10, 130, 20, LIGHTGRAY);
             DrawText(TextFormat("Block Pos: (%d, %d, %d)", 
-                     player.targetBlock.x, player.targetBlock.y, player.targetBlock.z), 
+                     frame->player.targetBlock.x, frame->player.targetBlock.y, frame->player.targetBlock.z), 
                      10, 150, 20, GRAY);
         } else {
             DrawText("Target Block: (none)", 10, 110, 20, DARKGRAY);
             DrawText("Texture: (none)", 10, 130, 20, DARKGRAY);
             DrawText("Block Pos: (-, -, -)", 10, 150, 20, DARKGRAY);
         }
+        
+        // Render load counters (top-right corner)
+        if (showRenderStats) {
+            DrawRenderStats(GetScreenWidth() - 320, 20);
+            DrawSimulationStats(frame, GetScreenWidth() - 630, 20);
+        }
     }
     
     // Controls help (when cursor is visible and game not paused)
@@ -241,11 +376,20 @@ void DrawGameplayScreen(void)
         DrawText("SPACE - Jump", 50, 220, 18, WHITE);
         DrawText("LEFT SHIFT - Run", 50, 240, 18, WHITE);
         DrawText("LEFT CLICK - Break block", 50, 260, 18, WHITE);
-        DrawText("RIGHT CLICK - Place block", 50, 280, 18, WHITE);
+        DrawText("RIGHT CLICK - Place block / flip lever", 50, 280, 18, WHITE);
         DrawText("1-9 - Select block type", 50, 300, 18, WHITE);
         DrawText("E - Open inventory", 50, 320, 18, WHITE);
         DrawText("ESC - Open pause menu", 50, 340, 18, WHITE);
         DrawText("ENTER - Return to menu", 50, 360, 18, WHITE);
+        DrawText("F3 - Toggle render stats", 50, 380, 18, WHITE);
+        DrawText("F4 - Export render stats (CSV)", 50, 400, 18, WHITE);
+        DrawText("F5 - Run job system benchmark", 50, 420, 18, WHITE);
+        DrawText("F6 - Spawn entity stress test", 50, 440, 18, WHITE);
+        DrawText("F7 - Spawn particle stress test", 50, 460, 18, WHITE);
+        DrawText("F8 - Build redstone benchmark circuit", 50, 480, 18, WHITE);
+        DrawText("F9 - Run mesher benchmark", 50, 500, 18, WHITE);
+        DrawText("F10 - Skip ahead 3 hours", 50, 520, 18, WHITE);
+        DrawText("F11 - Run texture atlas cache benchmark", 50, 540, 18, WHITE);
         
         DrawText("Click to start playing!", screenWidth/2 - 120, screenHeight - 50, 20, YELLOW);
     }
@@ -328,9 +472,47 @@ void DrawPauseMenu(void)
 // Gameplay Screen Unload logic
 void UnloadGameplayScreen(void)
 {
+    // Menu screens animate per frame, restore fixed frame rate
+    SetTargetFPS(60);
+    
     if (gameInitialized) {
+        // Stop simulation thread before releasing anything it may touch
+        WaitForSimulation();
+        if (simThread) {
+            LockMutex(simMutex);
+            simQuit = true;
+            BroadcastCondVar(simCondVar);
+            UnlockMutex(simMutex);
+            JoinThread(simThread);
+            simThread = NULL;
+        }
+        UnloadCondVar(simCondVar);
+        UnloadMutex(simMutex);
+        simCondVar = NULL;
+        simMutex = NULL;
+        
+        // Drain worker jobs that still read world chunks
+        WaitForMeshJobs();
+        
+        // Execute deferred GPU commands so uploaded meshes get released with the renderer
+        FlushFrameTasks();
+        
+        // Free frame snapshots, including geometry of uploads that never executed
+        UnloadRenderPacket(&frames[0].render);
+        UnloadRenderPacket(&frames[1].render);
+        UnloadEntityRenderList(&frames[0].entities);
+        UnloadEntityRenderList(&frames[1].entities);
+        UnloadParticleRenderList(&frames[0].particles);
+        UnloadParticleRenderList(&frames[1].particles);
+        ClearParticles();
+        UnloadFluidSystem();
+        UnloadBlockTicks();
+        UnloadRedstone();
+        
         UnloadVoxelWorld(&world);
         UnloadVoxelRenderer();
+        UnloadEntityRenderer();
+        UnloadParticleRenderer();
         gameInitialized = false;
     }
 }
@@ -340,3 +522,203 @@ int FinishGameplayScreen(void)
 {
     return finishScreen;
 }
+
+//----------------------------------------------------------------------------------
+// Simulation Thread Functions
+//----------------------------------------------------------------------------------
+
+// Advance world and player by the elapsed frame time and fill a frame snapshot
+static void SimulateFrame(GameplayFrame* frame, float frameTime)
+{
+    // Advance world and player simulation in fixed ticks
+    tickAccumulator += frameTime;
+    
+    int ticks = 0;
+    while ((tickAccumulator >= SIMULATION_TICK_TIME) && (ticks < MAX_TICKS_PER_FRAME))
+    {
+        // Update world (chunk loading/unloading)
+        UpdateVoxelWorld(&world, player.position);
+        
+        // Update player physics
+        TickPlayer(&player, &world, SIMULATION_TICK_TIME);
+        
+        // Update entities (batched over the job system)
+        UpdateEntities(&entities, &world, player.position, SIMULATION_TICK_TIME);
+        
+        // Run due fluid cell updates (bounded per tick)
+        UpdateFluids(&world);
+        
+        // Scheduled and random block ticks (falling blocks, grass, leaves, crops, ice)
+        UpdateBlockTicks(&world);
+        
+        // Evaluate redstone components whose inputs changed
+        UpdateRedstone(&world);
+        
+        tickAccumulator -= SIMULATION_TICK_TIME;
+        ticks++;
+    }
+    
+    // Drop backlog after a stall instead of trying to catch up
+    if (tickAccumulator > SIMULATION_TICK_TIME) tickAccumulator = SIMULATION_TICK_TIME;
+    
+    // Interpolate camera between the last two ticks, then resolve block targeting
+    UpdatePlayerCamera(&player, tickAccumulator/SIMULATION_TICK_TIME);
+    UpdatePlayerInteraction(&player, &world);
+    
+    // Cull, mesh and record the draw list for this camera
+    BuildRenderPacket(&frame->render, &world, player.camera);
+    BuildEntityRenderList(&entities, tickAccumulator/SIMULATION_TICK_TIME, &frame->entities);
+    
+    // Particles are cosmetic and follow the render frame rate instead of ticks
+    UpdateParticles(&world, player.position, frameTime);
+    BuildParticleRenderList(&frame->particles);
+    
+    // Snapshot everything the HUD reads
+    frame->player = player;
+    frame->fluids = GetFluidStats();
+    frame->blockTicks = GetBlockTickStats();
+    frame->redstone = GetRedstoneStats();
+    frame->lighting = GetLightingStats();
+    frame->timeOfDay = world.timeOfDay;
+    frame->playerChunk = WorldToChunk(player.position);
+    frame->chunkCount = world.chunkCount;
+    frame->currentChunkLoaded = (GetChunk(&world, frame->playerChunk) != NULL);
+    BlockPos groundPos = {(int)player.position.x, (int)(player.position.y - 1), (int)player.position.z};
+    frame->groundBlock = GetBlock(&world, groundPos);
+    frame->targetBlockType = GetBlock(&world, player.targetBlock);
+}
+
+static void SimulationThread(void* userData)
+{
+    (void)userData;
+    
+    LockMutex(simMutex);
+    while (true)
+    {
+        while (!simRequested && !simQuit) WaitCondVar(simCondVar, simMutex);
+        if (simQuit) break;
+        
+        GameplayFrame* frame = simTarget;
+        float frameTime = simFrameTime;
+        UnlockMutex(simMutex);
+        
+        SimulateFrame(frame, frameTime);
+        
+        LockMutex(simMutex);
+        simRequested = false;
+        simFrameReady = true;
+        BroadcastCondVar(simCondVar);
+    }
+    UnlockMutex(simMutex);
+}
+
+// Start simulating the next frame into the back buffer
+static void KickSimulation(float frameTime)
+{
+    GameplayFrame* frame = &frames[1 - frontFrame];
+    
+    if (!simThread)
+    {
+        // No thread support: simulate inline
+        SimulateFrame(frame, frameTime);
+        simFrameReady = true;
+        return;
+    }
+    
+    LockMutex(simMutex);
+    simTarget = frame;
+    simFrameTime = frameTime;
+    simRequested = true;
+    BroadcastCondVar(simCondVar);
+    UnlockMutex(simMutex);
+}
+
+// Block until the simulation is idle, returns true if it produced a new frame
+static bool WaitForSimulation(void)
+{
+    bool frameReady = false;
+    
+    if (simThread)
+    {
+        LockMutex(simMutex);
+        while (simRequested) WaitCondVar(simCondVar, simMutex);
+        frameReady = simFrameReady;
+        simFrameReady = false;
+        UnlockMutex(simMutex);
+    }
+    else
+    {
+        frameReady = simFrameReady;
+        simFrameReady = false;
+    }
+    
+    return frameReady;
+}
+
+// Subsystem counters panel, drawn next to the render stats panel in the same layout
+static void DrawSimulationStats(const GameplayFrame* frame, int posX, int posY)
+{
+    const int lineCount = 19;
+    int panelWidth = 300;
+    int panelHeight = 40 + lineCount*20;
+    int line = 0;
+    
+    DrawRectangle(posX, posY, panelWidth, panelHeight, (Color){0, 0, 0, 150});
+    DrawRectangleLines(posX, posY, panelWidth, panelHeight, WHITE);
+    DrawText("Simulation Stats", posX + 10, posY + 10, 18, YELLOW);
+    
+    DrawText(TextFormat("Jobs: %d workers, %d queued", GetJobWorkerCount(), GetQueuedJobCount()),
+             posX + 10, posY + 35 + 20*line++, 14, WHITE);
+    DrawText(TextFormat("Job bench: %.0f jobs/s", jobThroughput),
+             posX + 10, posY + 35 + 20*line++, 14, LIGHTGRAY);
+    DrawText(TextFormat("Mesher bench: %.3f ms/section", mesherTime),
+             posX + 10, posY + 35 + 20*line++, 14, LIGHTGRAY);
+    
+    FrameTaskStats tasks = GetFrameTaskStats();
+    DrawText(TextFormat("Frame tasks: %d run, %d deferred", tasks.tasksRun, tasks.tasksDeferred),
+             posX + 10, posY + 35 + 20*line++, 14, WHITE);
+    DrawText(TextFormat("Task time: %.2f/%.1f ms, %d starved", tasks.timeUsed, tasks.budget, tasks.tasksStarved),
+             posX + 10, posY + 35 + 20*line++, 14, LIGHTGRAY);
+    
+    EntityStats entityStats = frame->entities.stats;
+    DrawText(TextFormat("Entities: %d in %.2f ms", entityStats.entityCount, entityStats.updateTime),
+             posX + 10, posY + 35 + 20*line++, 14, WHITE);
+    DrawText(TextFormat("Entity pairs tested: %d", entityStats.pairsTested),
+             posX + 10, posY + 35 + 20*line++, 14, LIGHTGRAY);
+    
+    ParticleStats particleStats = frame->particles.stats;
+    DrawText(TextFormat("Particles: %d in %.3f ms", particleStats.particleCount, particleStats.updateTime),
+             posX + 10, posY + 35 + 20*line++, 14, WHITE);
+    
+    FluidStats fluidStats = frame->fluids;
+    DrawText(TextFormat("Fluids: %d active, %.2f ms", fluidStats.activeCells, fluidStats.updateTime),
+             posX + 10, posY + 35 + 20*line++, 14, WHITE);
+    DrawText(TextFormat("Fluid updates: %d, %d deferred", fluidStats.updatesProcessed, fluidStats.updatesDeferred),
+             posX + 10, posY + 35 + 20*line++, 14, LIGHTGRAY);
+    
+    BlockTickStats tickStats = frame->blockTicks;
+    DrawText(TextFormat("Block ticks: %d run, %.2f ms", tickStats.scheduledRun, tickStats.updateTime),
+             posX + 10, posY + 35 + 20*line++, 14, WHITE);
+    DrawText(TextFormat("Scheduled pending: %d", tickStats.scheduledPending),
+             posX + 10, posY + 35 + 20*line++, 14, LIGHTGRAY);
+    DrawText(TextFormat("Random: %d in %d sections", tickStats.randomTicks, tickStats.randomSections),
+             posX + 10, posY + 35 + 20*line++, 14, LIGHTGRAY);
+    
+    RedstoneStats redstoneStats = frame->redstone;
+    DrawText(TextFormat("Redstone: %d nodes, %.2f ms", redstoneStats.nodeCount, redstoneStats.updateTime),
+             posX + 10, posY + 35 + 20*line++, 14, WHITE);
+    DrawText(TextFormat("Nets: %d, changes: %d", redstoneStats.netCount, redstoneStats.stateChanges),
+             posX + 10, posY + 35 + 20*line++, 14, LIGHTGRAY);
+    DrawText(TextFormat("Events: %d, %d deferred", redstoneStats.eventsProcessed, redstoneStats.eventsDeferred),
+             posX + 10, posY + 35 + 20*line++, 14, LIGHTGRAY);
+    
+    LightingStats lightStats = frame->lighting;
+    int minutes = (int)(frame->timeOfDay*24*60);
+    DrawText(TextFormat("Light: %d cells, %.3f ms", lightStats.cellsChanged, lightStats.updateTime),
+             posX + 10, posY + 35 + 20*line++, 14, WHITE);
+    DrawText(TextFormat("Time: %02d:%02d, daylight %.2f", minutes/60, minutes%60, frame->render.daylight),
+             posX + 10, posY + 35 + 20*line++, 14, LIGHTGRAY);
+    
+    DrawText(TextFormat("Atlas: cold %.1f ms, warm %.1f ms", atlasTimes.coldTime, atlasTimes.warmTime),
+             posX + 10, posY + 35 + 20*line++, 14, WHITE);
+}
@@ -0,0 +1,213 @@
+#include "voxel_collision.h"
+#include "raymath.h"
+#include <math.h>
+
+/*
+---------------------------------------------------------------------------------
+Voxel Collision
+
+Swept axis-aligned boxes against the block grid, shared by the player and any other
+moving body. A move first gathers every cell touched by the box over the whole motion
+into a small local cache (one world lookup per cell, chunk reuse through
+BlockLookupCache). Each axis is then resolved in turn: the motion along it is clipped
+to the nearest solid cell face in its path, which gives the exact time of impact no
+matter how fast the box travels. Moves too long for the cache are split in parts.
+
+Resolving Y first lets a falling box land before sliding, X and Z follow.
+
+---------------------------------------------------------------------------------
+*/
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct {
+    int minX, minY, minZ;       // World cell at cache index (0, 0, 0)
+    int sizeX, sizeY, sizeZ;
+    bool solid[COLLISION_CACHE_SIZE][COLLISION_CACHE_SIZE][COLLISION_CACHE_SIZE];
+} CollisionCache;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions
+//----------------------------------------------------------------------------------
+// Cells overlapped by [min, max], faces only touched within epsilon are excluded
+static void GetCellRange(float min, float max, int* first, int* last) {
+    *first = (int)floorf(min + COLLISION_EPSILON);
+    *last = (int)floorf(max - COLLISION_EPSILON);
+}
+
+static BoundingBox OffsetBox(BoundingBox box, Vector3 offset) {
+    return (BoundingBox){ Vector3Add(box.min, offset), Vector3Add(box.max, offset) };
+}
+
+static void FillCollisionCache(VoxelWorld* world, CollisionCache* cache, int minX, int minY, int minZ,
+                               int sizeX, int sizeY, int sizeZ) {
+    BlockLookupCache lookup = { 0 };
+    
+    if (sizeX > COLLISION_CACHE_SIZE) sizeX = COLLISION_CACHE_SIZE;
+    if (sizeY > COLLISION_CACHE_SIZE) sizeY = COLLISION_CACHE_SIZE;
+    if (sizeZ > COLLISION_CACHE_SIZE) sizeZ = COLLISION_CACHE_SIZE;
+    
+    cache->minX = minX; cache->minY = minY; cache->minZ = minZ;
+    cache->sizeX = sizeX; cache->sizeY = sizeY; cache->sizeZ = sizeZ;
+    
+    for (int x = 0; x < sizeX; x++) {
+        for (int z = 0; z < sizeZ; z++) {
+            for (int y = 0; y < sizeY; y++) {
+                cache->solid[x][y][z] = IsBlockSolid(GetBlockCached(world, &lookup, minX + x, minY + y, minZ + z));
+            }
+        }
+    }
+}
+
+static bool IsCachedSolid(const CollisionCache* cache, int x, int y, int z) {
+    x -= cache->minX; y -= cache->minY; z -= cache->minZ;
+    if ((x < 0) || (y < 0) || (z < 0) || (x >= cache->sizeX) || (y >= cache->sizeY) || (z >= cache->sizeZ)) return false;
+    return cache->solid[x][y][z];
+}
+
+// Clip motion along one axis (0 = X, 1 = Y, 2 = Z) to the first solid cell in the way
+static float ClipAxisMotion(const CollisionCache* cache, BoundingBox box, int axis, float motion) {
+    if (motion == 0.0f) return 0.0f;
+    
+    float boxMin[3] = { box.min.x, box.min.y, box.min.z };
+    float boxMax[3] = { box.max.x, box.max.y, box.max.z };
+    
+    // Cells covered on the two other axes stay fixed during this axis sweep
+    int first[3], last[3];
+    for (int i = 0; i < 3; i++) GetCellRange(boxMin[i], boxMax[i], &first[i], &last[i]);
+    
+    // Cells crossed along the moving axis, nearest first
+    int start, end, step;
+    if (motion > 0.0f) {
+        start = (int)floorf(boxMax[axis] - COLLISION_EPSILON) + 1;
+        end = (int)floorf(boxMax[axis] + motion - COLLISION_EPSILON);
+        step = 1;
+    } else {
+        start = (int)floorf(boxMin[axis] + COLLISION_EPSILON) - 1;
+        end = (int)floorf(boxMin[axis] + motion + COLLISION_EPSILON);
+        step = -1;
+    }
+    
+    int a = (axis + 1) % 3;
+    int b = (axis + 2) % 3;
+    
+    for (int layer = start; (step > 0)? (layer <= end) : (layer >= end); layer += step) {
+        for (int i = first[a]; i <= last[a]; i++) {
+            for (int j = first[b]; j <= last[b]; j++) {
+                int cell[3];
+                cell[axis] = layer;
+                cell[a] = i;
+                cell[b] = j;
+                
+                if (!IsCachedSolid(cache, cell[0], cell[1], cell[2])) continue;
+                
+                // Nearest layer blocks first: stop flush against its face
+                float allowed = (step > 0)? layer - boxMax[axis] : (layer + 1) - boxMin[axis];
+                if (step > 0) return fmaxf(0.0f, fminf(motion, allowed));
+                return fminf(0.0f, fmaxf(motion, allowed));
+            }
+        }
+    }
+    
+    return motion;
+}
+
+static VoxelMoveResult MoveBoxStep(VoxelWorld* world, BoundingBox box, Vector3 motion) {
+    VoxelMoveResult result = { 0 };
+    
+    // Broadphase: every cell the box can touch during the whole move
+    BoundingBox swept = {
+        Vector3Min(box.min, Vector3Add(box.min, motion)),
+        Vector3Max(box.max, Vector3Add(box.max, motion))
+    };
+    
+    CollisionCache cache;
+    int minX = (int)floorf(swept.min.x), minY = (int)floorf(swept.min.y), minZ = (int)floorf(swept.min.z);
+    FillCollisionCache(world, &cache, minX, minY, minZ,
+                       (int)floorf(swept.max.x) - minX + 1,
+                       (int)floorf(swept.max.y) - minY + 1,
+                       (int)floorf(swept.max.z) - minZ + 1);
+    
+    // Narrowphase: resolve Y, X, Z, each axis starts from the box moved along the previous ones
+    float requested[3] = { motion.y, motion.x, motion.z };
+    int axes[3] = { 1, 0, 2 };
+    float applied[3] = { 0 };
+    bool hit[3] = { 0 };
+    
+    for (int i = 0; i < 3; i++) {
+        int axis = axes[i];
+        float clipped = ClipAxisMotion(&cache, box, axis, requested[i]);
+        
+        Vector3 offset = { 0 };
+        if (axis == 0) offset.x = clipped;
+        else if (axis == 1) offset.y = clipped;
+        else offset.z = clipped;
+        box = OffsetBox(box, offset);
+        
+        applied[axis] = clipped;
+        hit[axis] = (clipped != requested[i]);
+    }
+    
+    result.motion = (Vector3){ applied[0], applied[1], applied[2] };
+    result.hitX = hit[0];
+    result.hitY = hit[1];
+    result.hitZ = hit[2];
+    
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Collision Functions
+//----------------------------------------------------------------------------------
+VoxelMoveResult MoveBoxThroughWorld(VoxelWorld* world, BoundingBox box, Vector3 motion) {
+    // Split moves whose swept box would not fit in the local cache
+    // NOTE: A box spanning s units touches at most s + 2 cells per axis
+    Vector3 size = Vector3Subtract(box.max, box.min);
+    float available = COLLISION_CACHE_SIZE - 2 - fmaxf(size.x, fmaxf(size.y, size.z));
+    if (available < 1.0f) available = 1.0f;
+    
+    float longest = fmaxf(fabsf(motion.x), fmaxf(fabsf(motion.y), fabsf(motion.z)));
+    int parts = (int)ceilf(longest/available);
+    if (parts < 1) parts = 1;
+    
+    Vector3 partMotion = Vector3Scale(motion, 1.0f/parts);
+    VoxelMoveResult result = { 0 };
+    
+    for (int i = 0; i < parts; i++) {
+        VoxelMoveResult part = MoveBoxStep(world, box, partMotion);
+        box = OffsetBox(box, part.motion);
+        result.motion = Vector3Add(result.motion, part.motion);
+        
+        // An axis that hit something stays stopped for the remaining parts
+        if (part.hitX) { result.hitX = true; partMotion.x = 0.0f; }
+        if (part.hitY) { result.hitY = true; partMotion.y = 0.0f; }
+        if (part.hitZ) { result.hitZ = true; partMotion.z = 0.0f; }
+    }
+    
+    result.timeOfImpact = (Vector3){
+        (motion.x != 0.0f)? result.motion.x/motion.x : 1.0f,
+        (motion.y != 0.0f)? result.motion.y/motion.y : 1.0f,
+        (motion.z != 0.0f)? result.motion.z/motion.z : 1.0f
+    };
+    
+    return result;
+}
+
+bool CheckBoxCollision(VoxelWorld* world, BoundingBox box) {
+    BlockLookupCache lookup = { 0 };
+    int first[3], last[3];
+    GetCellRange(box.min.x, box.max.x, &first[0], &last[0]);
+    GetCellRange(box.min.y, box.max.y, &first[1], &last[1]);
+    GetCellRange(box.min.z, box.max.z, &first[2], &last[2]);
+    
+    for (int x = first[0]; x <= last[0]; x++) {
+        for (int z = first[2]; z <= last[2]; z++) {
+            for (int y = first[1]; y <= last[1]; y++) {
+                if (IsBlockSolid(GetBlockCached(world, &lookup, x, y, z))) return true;
+            }
+        }
+    }
+    
+    return false;
+}
@@ -0,0 +1,42 @@
+#ifndef VOXEL_COLLISION_H
+#define VOXEL_COLLISION_H
+
+#include "voxel_types.h"
+#include "voxel_world.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Collision Constants
+//----------------------------------------------------------------------------------
+#define COLLISION_CACHE_SIZE    16      // Max cells per axis gathered in one sweep (longer moves are split)
+#define COLLISION_EPSILON       0.0001f // Touching faces closer than this do not count as overlap
+
+//----------------------------------------------------------------------------------
+// Collision Result
+//----------------------------------------------------------------------------------
+typedef struct {
+    Vector3 motion;             // Displacement actually applied to the box
+    Vector3 timeOfImpact;       // Fraction of the requested motion travelled per axis [0..1]
+    bool hitX;                  // Motion was stopped on an axis
+    bool hitY;
+    bool hitZ;
+} VoxelMoveResult;
+
+//----------------------------------------------------------------------------------
+// Collision Functions
+// NOTE: Boxes collide with solid blocks only, ungenerated chunks count as empty
+//----------------------------------------------------------------------------------
+// Swept AABB: move box by motion, resolving Y then X then Z against the grid
+VoxelMoveResult MoveBoxThroughWorld(VoxelWorld* world, BoundingBox box, Vector3 motion);
+
+// True if any solid block overlaps the box
+bool CheckBoxCollision(VoxelWorld* world, BoundingBox box);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VOXEL_COLLISION_H
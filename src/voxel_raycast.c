@@ -0,0 +1,99 @@
+#include "voxel_raycast.h"
+#include "raymath.h"
+#include <math.h>
+
+/*
+---------------------------------------------------------------------------------
+Voxel Raycast
+
+Grid traversal after Amanatides and Woo: the ray is followed from cell boundary to cell
+boundary, stepping along whichever axis reaches its next boundary first. Each crossed
+cell is tested exactly once, corners can not be skipped and the axis of the last step
+gives the exact entry face and hit distance.
+
+Block lookups go through a BlockLookupCache, so the world chunk table is only searched
+when the ray crosses into another chunk. Batched casts share that cache.
+
+---------------------------------------------------------------------------------
+*/
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions
+//----------------------------------------------------------------------------------
+static VoxelRayHit CastRay(VoxelWorld* world, BlockLookupCache* cache, Vector3 origin, Vector3 direction, float maxDistance) {
+    VoxelRayHit result = { 0 };
+    
+    float length = Vector3Length(direction);
+    if (length <= 0.0f) return result;
+    
+    float dir[3] = { direction.x/length, direction.y/length, direction.z/length };
+    float start[3] = { origin.x, origin.y, origin.z };
+    int cell[3] = { (int)floorf(origin.x), (int)floorf(origin.y), (int)floorf(origin.z) };
+    int step[3];
+    float tMax[3];      // Ray distance at which the next boundary of each axis is crossed
+    float tDelta[3];    // Ray distance between two boundaries of each axis
+    
+    for (int axis = 0; axis < 3; axis++) {
+        if (dir[axis] > 0.0f) {
+            step[axis] = 1;
+            tDelta[axis] = 1.0f/dir[axis];
+            tMax[axis] = (cell[axis] + 1 - start[axis])*tDelta[axis];
+        } else if (dir[axis] < 0.0f) {
+            step[axis] = -1;
+            tDelta[axis] = -1.0f/dir[axis];
+            tMax[axis] = (start[axis] - cell[axis])*tDelta[axis];
+        } else {
+            step[axis] = 0;
+            tDelta[axis] = INFINITY;
+            tMax[axis] = INFINITY;
+        }
+    }
+    
+    int enteredAxis = -1;
+    float distance = 0.0f;
+    
+    while (distance <= maxDistance) {
+        BlockType block = GetBlockCached(world, cache, cell[0], cell[1], cell[2]);
+        
+        if (IsBlockTargetable(block)) {
+            result.hit = true;
+            result.block = (BlockPos){ cell[0], cell[1], cell[2] };
+            result.blockType = block;
+            result.distance = distance;
+            result.point = Vector3Add(origin, (Vector3){ dir[0]*distance, dir[1]*distance, dir[2]*distance });
+            
+            if (enteredAxis == 0) result.normal.x = (float)-step[0];
+            else if (enteredAxis == 1) result.normal.y = (float)-step[1];
+            else if (enteredAxis == 2) result.normal.z = (float)-step[2];
+            return result;
+        }
+        
+        // Step into the neighbor cell whose boundary is closest along the ray
+        int axis = (tMax[0] < tMax[1])? ((tMax[0] < tMax[2])? 0 : 2) : ((tMax[1] < tMax[2])? 1 : 2);
+        
+        distance = tMax[axis];
+        cell[axis] += step[axis];
+        tMax[axis] += tDelta[axis];
+        enteredAxis = axis;
+        
+        // Leaving the world vertically, nothing left to hit
+        if (((cell[1] < 0) && (step[1] <= 0)) || ((cell[1] >= WORLD_HEIGHT) && (step[1] >= 0))) break;
+    }
+    
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Raycast Functions
+//----------------------------------------------------------------------------------
+VoxelRayHit RaycastVoxels(VoxelWorld* world, Vector3 origin, Vector3 direction, float maxDistance) {
+    BlockLookupCache cache = { 0 };
+    return CastRay(world, &cache, origin, direction, maxDistance);
+}
+
+void RaycastVoxelsBatch(VoxelWorld* world, const Ray* rays, int count, float maxDistance, VoxelRayHit* hits) {
+    BlockLookupCache cache = { 0 };
+    for (int i = 0; i < count; i++) {
+        hits[i] = CastRay(world, &cache, rays[i].position, rays[i].direction, maxDistance);
+    }
+}
@@ -0,0 +1,36 @@
+#ifndef VOXEL_RAYCAST_H
+#define VOXEL_RAYCAST_H
+
+#include "voxel_types.h"
+#include "voxel_world.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Raycast Result
+//----------------------------------------------------------------------------------
+typedef struct {
+    bool hit;
+    BlockPos block;             // First targetable block crossed by the ray (anything but air and water)
+    Vector3 normal;             // Face the ray entered through (zero if the ray starts inside the block)
+    Vector3 point;              // Entry point on that face
+    float distance;             // Distance from origin to the entry point
+    BlockType blockType;
+} VoxelRayHit;
+
+//----------------------------------------------------------------------------------
+// Raycast Functions
+// NOTE: Exact grid traversal (Amanatides-Woo), every crossed cell is visited once
+//----------------------------------------------------------------------------------
+VoxelRayHit RaycastVoxels(VoxelWorld* world, Vector3 origin, Vector3 direction, float maxDistance);
+
+// Cast count rays at once, chunk lookups are shared between rays (hits must hold count entries)
+void RaycastVoxelsBatch(VoxelWorld* world, const Ray* rays, int count, float maxDistance, VoxelRayHit* hits);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VOXEL_RAYCAST_H
@@ -1,4 +1,12 @@
 #include "voxel_renderer.h"
+#include "render_stats.h"
+#include "job_system.h"
+#include "frame_scheduler.h"
+#include "fluid_system.h"
+#include "block_ticks.h"
+#include "redstone.h"
+#include "world_lighting.h"
+#include "platform_threads.h"
 #include "raymath.h"
 #include "rlgl.h"
 #include <stdlib.h>
@@ -11,19 +19,67 @@
 Voxel Renderer
 
 Chunk-based voxel world rendering with dual-pass transparency.
-Each chunk generates two separate meshes: one for opaque blocks and one for transparent
-blocks (e.g., glass, leaves, water). During rendering, opaque meshes are drawn first
-(front-to-back) with depth writing enabled, followed by transparent meshes (back-to-front)
-with depth masking disabled to ensure correct alpha blending.
+Each chunk section generates three separate meshes: one for opaque blocks, one for transparent
+blocks (e.g., glass, leaves) and one for liquids. During rendering, opaque meshes are drawn
+first (front-to-back) with depth writing enabled, followed by transparent meshes and then
+liquid meshes (back-to-front) with depth masking disabled to ensure correct alpha blending.
 
 Block textures are packed into a single atlas for efficient GPU usage. Texture coordinates
 for each block face are precomputed and stored in the texture manager. Face culling and
 neighbor checks are used to avoid drawing hidden faces, improving performance.
 
+The packed atlas and its UV and name tables are cached in one binary file keyed by the input
+files and their modification times, so later launches skip decoding and packing every PNG.
+On a rebuild the PNGs are decoded in batches on the job system.
+
+On desktop GL 3.3 the chunk shader samples a copy of the atlas as a texture array, one
+mipmapped layer per texture, so distant terrain is mipmapped without bleeding between tiles.
+
+Animated textures (water, lava) get one atlas slot per frame. The chunk shader moves each
+face to the current frame from a table uploaded once, so animating costs one uniform per frame.
+
+The liquid mesh is drawn with its own shader, and its surface corners follow the liquid
+levels around them. Evenly shaded surface faces merge into one quad per row.
+
 The renderer integrates with the world/chunk system and player camera. It exposes functions
 to update chunk meshes when blocks change, and to render visible chunks based on camera
 frustum culling. All block face geometry, normals, and UVs are generated procedurally.
 
+Work is split across two threads: the simulation thread culls chunks, builds CPU meshes
+(in parallel on the job system) and records a RenderPacket (sorted draw list plus upload/release commands), while the
+main thread, which owns the GL context, executes those commands and issues draw calls.
+GPU meshes are kept per chunk slot inside the renderer, the world never touches GL.
+
+Meshes are built and uploaded per chunk section (CHUNK_SECTION_HEIGHT blocks tall): edits
+mark only the sections they touch, so a block change rebuilds a 16x16x16 slice instead of
+the whole column, and any number of edits in a tick cost one rebuild per section.
+
+Smooth lighting and ambient occlusion travel in the vertex colors. Before meshing, the
+section and a one block border are copied into a padded buffer (blocks, occluder flags and
+light), so face culling and the per-vertex samples are plain array reads instead of
+neighborhood lookups. Each vertex reads the cell in front of its face plus the two side
+cells and the corner cell around that vertex (index deltas precomputed per face and corner),
+the occluders index a 3 bit AO table and the open cells are averaged for light. Quads are
+split along the brighter diagonal so occlusion does not streak across the face.
+
+The smoothed sky and block levels go in the second texcoord set, the vertex color holds the
+biome tint (rgb) and AO (alpha). The chunk shader turns the levels into a color through the
+lightmap texture (optifine/lightmap/world0.png), using the sun brightness of the time of day
+as the sky column. A full day/night cycle is one uniform per frame, no mesh is rebuilt.
+Without the shader the mesher bakes daylight brightness and tint into the colors instead.
+
+Grass tops and leaves are tinted from the biome colormaps (grass, foliage, their swamp
+variants and birch). The colormaps are sampled once per column from the climate cached in
+the chunk, and each vertex takes the average of the four columns meeting at its corner, so
+biome borders blend smoothly.
+
+Glass uses OptiFine connected textures (optifine/ctm, the 47 tile layout). Each glass face
+reads its 8 in-plane neighbors from the padded buffer into a bitmask (a neighbor connects
+when it is the same block with its own face exposed), and a 256 entry table built at init
+maps the mask to a tile. The tiles follow the atlas name lookup, so the cost is a few array
+reads per glass face, and since the padding already covers the neighbors an edit still
+remeshes only the sections that see the block.
+
 ---------------------------------------------------------------------------------
 */
 
@@ -32,8 +88,117 @@ frustum culling. All block face geometry, normals, and UVs are generated procedu
 //----------------------------------------------------------------------------------
 // Local Constants
 //----------------------------------------------------------------------------------
-#define MAX_VERTICES_PER_CHUNK (CHUNK_SIZE * CHUNK_SIZE * WORLD_HEIGHT * 6 * 4) // 6 faces, 4 vertices each
-#define MAX_TRIANGLES_PER_CHUNK (CHUNK_SIZE * CHUNK_SIZE * WORLD_HEIGHT * 6 * 2) // 6 faces, 2 triangles each
+#if defined(PLATFORM_WEB)
+    #define GLSL_VERSION 100
+#else
+    #define GLSL_VERSION 330
+#endif
+
+// Block texture array path (desktop GL 3.3), build with NO_TEXTURE_ARRAY to render from the atlas only
+// NOTE: CMake defines NO_TEXTURE_ARRAY when raylib comes without its source tree (no external/glad.h)
+#if !defined(PLATFORM_WEB) && !defined(NO_TEXTURE_ARRAY)
+    #define BLOCK_TEXTURE_ARRAY
+    #include "external/glad.h"          // raylib GL loader, rlgl has no texture array functions
+#endif
+
+#define TEXTURE_ARRAY_UNIT 2                // Texture unit of the block array, chunk materials bind units 0 and 1
+#define TEXTURE_LAYER_STRIDE 32.0f          // Mesh v per array layer (atlas slot on liquid faces), tile coords stay below 3/4 of it
+#define TEXTURE_ANIMATION_STRIDE 32.0f      // Mesh u per animation id, tile coords stay below 3/4 of it (chunk shaders)
+#define MAX_TEXTURE_ANIMATIONS 8            // Animation table size of the chunk shaders, id 0 is not animated
+#define LIQUID_TINT_DEPTH 8                 // Water this deep under the surface gets the full depth tint (liquid shader)
+
+#define MAX_VERTICES_PER_SECTION (CHUNK_SIZE * CHUNK_SIZE * CHUNK_SECTION_HEIGHT * 6 * 4) // 6 faces, 4 vertices each
+#define MAX_TRIANGLES_PER_SECTION (CHUNK_SIZE * CHUNK_SIZE * CHUNK_SECTION_HEIGHT * 6 * 2) // 6 faces, 2 triangles each
+
+// Section plus a one block border, z fastest as in Chunk.blocks
+#define PADDED_SIZE (CHUNK_SIZE + 2)
+#define PADDED_HEIGHT (CHUNK_SECTION_HEIGHT + 2)
+#define PADDED_CELLS (PADDED_SIZE * PADDED_HEIGHT * PADDED_SIZE)
+#define PADDED_STRIDE_Z 1
+#define PADDED_STRIDE_Y PADDED_SIZE
+#define PADDED_STRIDE_X (PADDED_SIZE * PADDED_HEIGHT)
+
+// Texture atlas cache, rebuilt when any input file changes
+#define ATLAS_CACHE_FILE "texture_atlas.cache"
+#define ATLAS_CACHE_MAGIC 0x43415856        // "VXAC"
+#define ATLAS_CACHE_VERSION 3
+#define MISSING_TEXTURE "missing"             // Atlas entry drawn for block texture names the atlas does not hold
+#define ATLAS_DECODE_BATCH 8                // Atlas inputs decoded per job
+
+// Number of tiles of a connected texture set (OptiFine "ctm" method)
+#define CTM_TILE_COUNT 47
+
+// In-plane neighbors of a face in texture space, bits of the connection mask
+#define CTM_UP          0x01
+#define CTM_DOWN        0x02
+#define CTM_LEFT        0x04
+#define CTM_RIGHT       0x08
+#define CTM_UP_LEFT     0x10
+#define CTM_UP_RIGHT    0x20
+#define CTM_DOWN_LEFT   0x40
+#define CTM_DOWN_RIGHT  0x80
+
+// Last bytes of the atlas cache file, after pixels, connected texture tiles, UVs and names
+typedef struct {
+    unsigned int magic;
+    unsigned int version;
+    unsigned long long key;         // Hash of the input files and their modification times
+    int atlasSize;
+    int textureSize;
+    int blockCount;
+    int textureCount;
+} AtlasCacheFooter;
+
+// One atlas input, resolved on the calling thread and decoded by a job
+typedef struct {
+    char path[256];             // Resolved file, empty when the texture has no file
+    char name[64];              // Atlas name, as stored in the texture manager
+    Color fallback;             // Placeholder color when the file is missing or fails to decode
+    Image image;                // Decoded RGBA, frameCount TEXTURE_SIZE squares stacked vertically
+    int frameCount;             // Atlas slots taken, above 1 only for animation strips
+    bool animated;              // Vertical strip of square frames
+    bool decoded;               // False when the placeholder was used
+} AtlasSource;
+
+// Animated block texture, a vertical strip of square frames that fills consecutive atlas slots
+// NOTE: Frame 0 keeps the texture name, the next frames are "<name>/1", "<name>/2"...
+typedef struct {
+    const char* name;
+    int frameTicks;             // Simulation ticks per frame
+    Color fallback;             // Single frame placeholder when the strip is missing
+} AnimatedTexture;
+
+typedef struct {
+    AtlasSource* sources;
+    int start;
+    int end;
+} AtlasDecodeBatch;
+
+// Biome tints of a column, one colormap lookup each
+typedef enum {
+    TINT_GRASS = 0,
+    TINT_FOLIAGE,
+    TINT_BIRCH,
+    TINT_KINDS,
+    TINT_NONE = -1
+} BiomeTint;
+
+typedef enum {
+    COLORMAP_GRASS = 0,
+    COLORMAP_FOLIAGE,
+    COLORMAP_SWAMP_GRASS,
+    COLORMAP_SWAMP_FOLIAGE,
+    COLORMAP_BIRCH,
+    COLORMAP_COUNT
+} ColormapType;
+
+// Climate colormap kept on the CPU for the mesher, temperature along x and humidity along y
+typedef struct {
+    Color* colors;              // NULL if the image is missing, fallback is used instead
+    int width;
+    int height;
+    Color fallback;
+} BiomeColormap;
 
 //----------------------------------------------------------------------------------
 // Global Variables
@@ -41,7 +206,24 @@ frustum culling. All block face geometry, normals, and UVs are generated procedu
 static TextureManager textureManager = {0};
 static Material globalOpaqueMaterial = {0};
 static Material globalTransparentMaterial = {0};
+static Material globalLiquidMaterial = {0};
 static bool materialsInitialized = false;
+static Shader chunkShader = {0};            // Lightmap shader shared by both chunk materials
+static Texture2D lightmap = {0};
+static int daylightLoc = -1;
+static bool shaderLighting = false;         // Light levels go to texcoords2, else baked into the colors
+static BiomeColormap colormaps[COLORMAP_COUNT] = {0};
+static int ctmFirstTile[BLOCK_COUNT] = {0};     // Atlas index of tile 0 of the block set, -1 without one
+static unsigned int blockTextureArray = 0;      // GL_TEXTURE_2D_ARRAY, one mipmapped layer per texture index
+static bool textureArrayEnabled = false;        // Chunk shader samples blockTextureArray instead of the atlas
+static float meshTexCoords[MAX_BLOCK_TEXTURES][4] = {0};    // Mesher rect per texture index (see InitMeshTexCoords)
+static unsigned char textureAnimationIds[MAX_BLOCK_TEXTURES] = {0};     // Animation of frame 0 textures, 0 if static
+static float textureAnimations[MAX_TEXTURE_ANIMATIONS][4] = {0};        // First slot, frames, ticks per frame, slots per row
+static int animationTicksLoc = -1;
+static Shader liquidShader = {0};           // Water surface shader, without it liquids draw with the transparent material
+static int liquidDaylightLoc = -1;
+static int liquidTicksLoc = -1;
+static bool liquidShading = false;          // Liquid faces carry slot tile coords and water depth (liquid shader)
 
 // Face normal vectors
 static const Vector3 faceNormals[6] = {
@@ -87,16 +269,495 @@ static const Vector2 faceUVs[4] = {
     {0.0f, 0.0f}  // Top-left
 };
 
+// Crossed diagonal quads of plants, each plane listed once per side (same corner order as faceVertices)
+static const Vector3 crossVertices[4][4] = {
+    {{0, 0, 0}, {1, 0, 1}, {1, 1, 1}, {0, 1, 0}},
+    {{1, 0, 1}, {0, 0, 0}, {0, 1, 0}, {1, 1, 1}},
+    {{1, 0, 0}, {0, 0, 1}, {0, 1, 1}, {1, 1, 0}},
+    {{0, 0, 1}, {1, 0, 0}, {1, 1, 0}, {0, 1, 1}}
+};
+
+// Redstone wire lies flat on the block below
+static const Vector3 wireVertices[1][4] = {
+    {{0, 0.0625f, 1}, {1, 0.0625f, 1}, {1, 0.0625f, 0}, {0, 0.0625f, 0}}
+};
+
+// Shape of each connected texture tile: open edges (CTM_UP...) plus a diagonal bit for every inner
+// corner seam, where both edges connect but the block across the corner does not
+static const unsigned char ctmTileShapes[CTM_TILE_COUNT] = {
+    0,
+    CTM_RIGHT,
+    CTM_LEFT | CTM_RIGHT,
+    CTM_LEFT,
+    CTM_DOWN | CTM_RIGHT | CTM_DOWN_RIGHT,
+    CTM_DOWN | CTM_LEFT | CTM_DOWN_LEFT,
+    CTM_UP | CTM_DOWN | CTM_RIGHT | CTM_UP_RIGHT | CTM_DOWN_RIGHT,
+    CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_DOWN_LEFT | CTM_DOWN_RIGHT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_UP_LEFT | CTM_DOWN_LEFT | CTM_DOWN_RIGHT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_UP_LEFT | CTM_UP_RIGHT | CTM_DOWN_LEFT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_UP_RIGHT | CTM_DOWN_RIGHT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_DOWN_LEFT | CTM_DOWN_RIGHT,
+    CTM_DOWN,
+    CTM_DOWN | CTM_RIGHT,
+    CTM_DOWN | CTM_LEFT | CTM_RIGHT,
+    CTM_DOWN | CTM_LEFT,
+    CTM_UP | CTM_RIGHT | CTM_UP_RIGHT,
+    CTM_UP | CTM_LEFT | CTM_UP_LEFT,
+    CTM_UP | CTM_LEFT | CTM_RIGHT | CTM_UP_LEFT | CTM_UP_RIGHT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_UP_LEFT | CTM_DOWN_LEFT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_UP_RIGHT | CTM_DOWN_LEFT | CTM_DOWN_RIGHT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_UP_LEFT | CTM_UP_RIGHT | CTM_DOWN_RIGHT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_UP_LEFT | CTM_UP_RIGHT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_UP_LEFT | CTM_DOWN_LEFT,
+    CTM_UP | CTM_DOWN,
+    CTM_UP | CTM_DOWN | CTM_RIGHT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT,
+    CTM_UP | CTM_DOWN | CTM_LEFT,
+    CTM_UP | CTM_DOWN | CTM_RIGHT | CTM_UP_RIGHT,
+    CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_DOWN_RIGHT,
+    CTM_UP | CTM_DOWN | CTM_RIGHT | CTM_DOWN_RIGHT,
+    CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_DOWN_LEFT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_DOWN_RIGHT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_DOWN_LEFT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_UP_LEFT | CTM_DOWN_RIGHT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_UP_RIGHT | CTM_DOWN_LEFT,
+    CTM_UP,
+    CTM_UP | CTM_RIGHT,
+    CTM_UP | CTM_LEFT | CTM_RIGHT,
+    CTM_UP | CTM_LEFT,
+    CTM_UP | CTM_LEFT | CTM_RIGHT | CTM_UP_LEFT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_DOWN_LEFT,
+    CTM_UP | CTM_LEFT | CTM_RIGHT | CTM_UP_RIGHT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_UP_LEFT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_UP_RIGHT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_UP_LEFT,
+    CTM_UP | CTM_DOWN | CTM_LEFT | CTM_RIGHT | CTM_UP_LEFT | CTM_UP_RIGHT | CTM_DOWN_LEFT | CTM_DOWN_RIGHT
+};
+
+// Connection mask to tile, derived from ctmTileShapes at init
+static unsigned char ctmTiles[256] = {0};
+
+// Padded buffer deltas of the 8 neighbors of a face (mask bit order), derived from the face UVs at init
+static int ctmNeighborDeltas[6][8] = {0};
+
+// Baked vertex brightness per light level without the chunk shader: level/15 bent by f/(3 - 2f),
+// over an 8% ambient floor
+static const unsigned char lightBrightness[MAX_LIGHT_LEVEL + 1] = {
+    20, 26, 32, 38, 46, 54, 63, 73, 85, 99, 114, 133, 154, 181, 214, 255
+};
+
+// Occlusion level (0 darkest, 3 open) of a vertex by its occluders: bit 0 side, bit 1 other side, bit 2 corner
+// NOTE: Both sides blocked hide the corner, the vertex is fully occluded whatever the corner holds
+static const unsigned char aoLevels[8] = { 3, 2, 2, 0, 2, 1, 1, 0 };
+
+// Brightness scale per occlusion level (255 = unchanged)
+static const unsigned char aoBrightness[4] = { 128, 170, 212, 255 };
+
+// Padded buffer index deltas of the side, side and corner cells around each face corner, relative to the
+// cell in front of the face (filled by InitAmbientOcclusion() from faceVertices)
+static int aoSampleDeltas[6][4][3] = {0};
+
+// Block textures packed into the atlas, in atlas order
+static const char* blockTextureNames[] = {
+    "grass_block_top", "grass_block_side", "dirt",
+    "stone", "cobblestone", "bedrock", "sand", "gravel",
+    "oak_log", "oak_log_top", "oak_planks", "oak_leaves",
+    "birch_log", "birch_log_top", "birch_planks", "birch_leaves",
+    "acacia_log", "acacia_log_top", "acacia_planks", "acacia_leaves",
+    "dark_oak_log", "dark_oak_log_top", "dark_oak_planks", "dark_oak_leaves",
+    "stone_bricks", "mossy_stone_bricks", "andesite", "granite", "diorite",
+    "sandstone", "sandstone_top", "sandstone_bottom",
+    "coal_ore", "iron_ore", "gold_ore", "diamond_ore",
+    "iron_block", "gold_block", "diamond_block",
+    "white_wool", "orange_wool", "blue_wool", "red_wool",
+    "glass", "bricks", "bookshelf", "glowstone", "obsidian",
+    "netherrack", "end_stone", "quartz_block_side", "packed_ice", "ice",
+    "wheat_stage0", "wheat_stage1", "wheat_stage2", "wheat_stage3",
+    "wheat_stage4", "wheat_stage5", "wheat_stage6", "wheat_stage7",
+    "redstone_block", "redstone_dust_dot", "redstone_torch", "redstone_torch_off",
+    "lever", "redstone_lamp", "redstone_lamp_on",
+    "white_stained_glass", "orange_stained_glass", "magenta_stained_glass", "light_blue_stained_glass",
+    "yellow_stained_glass", "lime_stained_glass", "pink_stained_glass", "gray_stained_glass",
+    "light_gray_stained_glass", "cyan_stained_glass", "purple_stained_glass", "blue_stained_glass",
+    "brown_stained_glass", "green_stained_glass", "red_stained_glass", "black_stained_glass",
+    "mossy_cobblestone", "stone_slab_top", "chiseled_sandstone", "cut_sandstone", "red_sand", "red_sandstone",
+    "redstone_ore", "emerald_ore", "lapis_ore", "emerald_block", "lapis_block", "coal_block",
+    "magenta_wool", "light_blue_wool", "yellow_wool", "lime_wool", "pink_wool", "gray_wool",
+    "light_gray_wool", "cyan_wool", "purple_wool", "brown_wool", "green_wool", "black_wool",
+    "crafting_table_top", "crafting_table_side", "furnace_side", "soul_sand", "purpur_block", "blue_ice", "snow",
+    "cactus_top", "cactus_bottom", "cactus_side", "pumpkin_side", "jack_o_lantern", "melon_side",
+    "hay_block_top", "hay_block_side"
+};
+
+// Placeholder colors of block textures missing on disk, by atlas index
+static const Color placeholderColors[] = {
+    { 0, 228, 48, 255 }, { 0, 117, 44, 255 }, { 127, 106, 79, 255 }, { 130, 130, 130, 255 }, { 80, 80, 80, 255 }, { 64, 64, 64, 255 },
+    { 211, 176, 131, 255 }, { 136, 136, 136, 255 }, { 139, 69, 19, 255 }, { 162, 130, 78, 255 },
+    { 0, 117, 44, 255 }, { 220, 220, 220, 255 }, { 192, 175, 121, 255 }, { 128, 167, 85, 255 },
+    { 186, 99, 64, 255 }, { 168, 90, 50, 255 }, { 99, 128, 15, 255 }, { 66, 43, 20, 255 },
+    { 123, 123, 123, 255 }, { 115, 121, 105, 255 }, { 132, 134, 132, 255 }, { 149, 103, 85, 255 },
+    { 188, 188, 188, 255 }, { 245, 238, 173, 255 }, { 84, 84, 84, 255 }, { 135, 106, 97, 255 },
+    { 143, 140, 125, 255 }, { 92, 219, 213, 255 }, { 220, 220, 220, 255 }, { 255, 203, 0, 255 },
+    { 93, 219, 213, 255 }, { 255, 255, 255, 255 }, { 255, 161, 0, 255 }, { 0, 121, 241, 255 }, { 230, 41, 55, 255 }, { 255, 255, 255, 128 },
+    { 150, 97, 83, 255 }, { 139, 69, 19, 255 }, { 255, 207, 139, 255 }, { 20, 18, 30, 255 },
+    { 97, 38, 38, 255 }, { 221, 223, 165, 255 }, { 235, 229, 222, 255 }, { 160, 160, 255, 255 }
+};
+
+// Animation strips, packed after the connected texture tiles
+static const AnimatedTexture animatedTextures[] = {
+    { "water_still", 2, { 63, 118, 228, 180 } },
+    { "water_flow", 1, { 63, 118, 228, 180 } },
+    { "lava_still", 2, { 207, 92, 15, 255 } }
+};
+
+static const char* colormapFiles[COLORMAP_COUNT] = {
+    "textures/colormap/grass.png", "textures/colormap/foliage.png",
+    "optifine/colormap/swampgrass.png", "optifine/colormap/swampfoliage.png", "optifine/colormap/birch.png"
+};
+
+// Plains colors, used when a colormap image is missing
+static const Color colormapFallbacks[COLORMAP_COUNT] = {
+    { 145, 189, 89, 255 }, { 119, 171, 47, 255 }, { 106, 112, 57, 255 }, { 106, 112, 57, 255 }, { 128, 167, 85, 255 }
+};
+
+// Wheat texture per growth stage (block data)
+static const char* wheatStageTextures[WHEAT_MAX_STAGE + 1] = {
+    "wheat_stage0", "wheat_stage1", "wheat_stage2", "wheat_stage3",
+    "wheat_stage4", "wheat_stage5", "wheat_stage6", "wheat_stage7"
+};
+
+// GPU-side chunk geometry, indexed by world chunk slot (main thread only)
+typedef struct {
+    Mesh mesh[CHUNK_SECTIONS];
+    Mesh transparentMesh[CHUNK_SECTIONS];
+    Mesh liquidMesh[CHUNK_SECTIONS];
+    ChunkPos position;                  // Chunk the uploaded geometry belongs to
+    unsigned int drawnFrame;            // Last RenderVoxelWorld() call that drew some of it
+    bool hasMesh;
+} ChunkGpuMesh;
+
+// Simulation-side record of which chunk each slot's GPU mesh belongs to
+typedef struct {
+    ChunkPos position;
+    bool valid;
+} ChunkMeshSlot;
+
+// Asynchronous mesh build, at most one in flight per chunk slot
+typedef struct {
+    ChunkNeighborhood neighborhood;     // Chunks pinned for the job duration
+    ChunkPos position;                  // Chunk the mesh is built for
+    unsigned int versions[CHUNK_NEIGHBORS + 1]; // Content versions of center and neighbors at submit time
+    unsigned int sections;              // Sections rebuilt by the job (bit mask)
+    Mesh opaqueMeshes[CHUNK_SECTIONS];  // Results, valid once done is set
+    Mesh transparentMeshes[CHUNK_SECTIONS];
+    Mesh liquidMeshes[CHUNK_SECTIONS];
+    volatile int cancelled;             // Cancellation token, polled by the worker
+    volatile int done;
+    bool inFlight;
+} MeshJob;
+
+// Padded copy of a section read by the mesher
+typedef struct {
+    BlockType blocks[PADDED_CELLS];
+    unsigned char occluders[PADDED_CELLS];  // Opaque cubes, darken the corners next to them
+    unsigned char skyLight[PADDED_CELLS];
+    unsigned char blockLight[PADDED_CELLS];
+    unsigned char blockData[PADDED_CELLS];
+    unsigned char liquidDepths[PADDED_CELLS];   // Liquid cells from this one down, up to LIQUID_TINT_DEPTH
+    bool tintsReady;                        // Corner tints are filled on the first tinted face
+    Color cornerTints[TINT_KINDS][CHUNK_SIZE + 1][CHUNK_SIZE + 1];     // Average of the 4 columns at each corner
+} SectionPadding;
+
+// Atlas index of every block face and block state texture, resolved once per atlas load
+typedef struct {
+    short faces[BLOCK_COUNT][6];
+    short wheatStages[WHEAT_MAX_STAGE + 1];
+    short lampOn;                           // Powered redstone lamp
+    short torchOff;                         // Unpowered redstone torch
+    short wirePowered;                      // Powered redstone wire
+} BlockTextureTable;
+
+// Surface of a liquid cell at its 4 corners, indexed by the corner offset [x][z]
+typedef struct {
+    float heights[2][2];                    // Surface height above the cell floor
+    float depths[2][2];                     // Liquid under the surface over LIQUID_TINT_DEPTH, 0 for dry cells
+} LiquidCorners;
+
+static ChunkGpuMesh chunkMeshes[MAX_CHUNKS] = {0};
+static ChunkMeshSlot meshSlots[MAX_CHUNKS] = {0};
+static MeshJob meshJobs[MAX_CHUNKS] = {0};
+static JobCounter meshJobCounter = {0};
+static unsigned int renderFrame = 0;        // RenderVoxelWorld() calls, tags the chunks drawn in each
+static BlockTextureTable blockTextures = {0};   // Filled by InitBlockTextureTable(), read by the mesher
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static int GetBlockTextureIndex(BlockType block, int faceIndex);    // Shared by the mesher and GetBlockTextureUV()
+static void UnloadBlockTextureArray(void);
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions
+//----------------------------------------------------------------------------------
+static void PushRenderCommand(RenderPacket* packet, RenderCommand command) {
+    if (packet->commandCount >= packet->commandCapacity) {
+        int newCapacity = (packet->commandCapacity > 0)? packet->commandCapacity*2 : 64;
+        packet->commands = (RenderCommand*)realloc(packet->commands, newCapacity*sizeof(RenderCommand));
+        packet->commandCapacity = newCapacity;
+    }
+    packet->commands[packet->commandCount++] = command;
+}
+
+// Free CPU geometry that never reached the GPU (no GL calls, safe on any thread)
+static void FreeMeshData(Mesh* mesh) {
+    RL_FREE(mesh->vertices);
+    RL_FREE(mesh->texcoords);
+    RL_FREE(mesh->colors);
+    RL_FREE(mesh->texcoords2);
+    RL_FREE(mesh->indices);
+    *mesh = (Mesh){0};
+}
+
+static void FreeJobMeshes(MeshJob* job) {
+    for (int s = 0; s < CHUNK_SECTIONS; s++) {
+        FreeMeshData(&job->opaqueMeshes[s]);
+        FreeMeshData(&job->transparentMeshes[s]);
+        FreeMeshData(&job->liquidMeshes[s]);
+    }
+}
+
+static void ReleaseSectionGpuMesh(ChunkGpuMesh* gpu, int section) {
+    if (gpu->mesh[section].vertexCount > 0) UnloadMesh(gpu->mesh[section]);
+    if (gpu->transparentMesh[section].vertexCount > 0) UnloadMesh(gpu->transparentMesh[section]);
+    if (gpu->liquidMesh[section].vertexCount > 0) UnloadMesh(gpu->liquidMesh[section]);
+    gpu->mesh[section] = (Mesh){0};
+    gpu->transparentMesh[section] = (Mesh){0};
+    gpu->liquidMesh[section] = (Mesh){0};
+}
+
+static void ReleaseChunkGpuMesh(int chunkIndex) {
+    ChunkGpuMesh* gpu = &chunkMeshes[chunkIndex];
+    if (!gpu->hasMesh) return;
+
+    for (int s = 0; s < CHUNK_SECTIONS; s++) ReleaseSectionGpuMesh(gpu, s);
+    *gpu = (ChunkGpuMesh){0};
+}
+
+// Frame task: execute one GPU resource command, userData is a heap copy of the command
+static void ExecuteRenderCommandTask(void* userData) {
+    RenderCommand* command = (RenderCommand*)userData;
+    ChunkGpuMesh* gpu = &chunkMeshes[command->chunkIndex];
+    
+    if (command->type == RENDER_COMMAND_RELEASE_MESH) {
+        ReleaseChunkGpuMesh(command->chunkIndex);
+    } else {
+        // Sections left by the previous occupant of the slot go away with its first upload
+        if (gpu->hasMesh && !ChunkPosEqual(gpu->position, command->position)) ReleaseChunkGpuMesh(command->chunkIndex);
+        ReleaseSectionGpuMesh(gpu, command->section);
+        
+        if (command->opaqueMesh.vertexCount > 0) UploadMesh(&command->opaqueMesh, false);
+        if (command->transparentMesh.vertexCount > 0) UploadMesh(&command->transparentMesh, false);
+        if (command->liquidMesh.vertexCount > 0) UploadMesh(&command->liquidMesh, false);
+        
+        gpu->mesh[command->section] = command->opaqueMesh;
+        gpu->transparentMesh[command->section] = command->transparentMesh;
+        gpu->liquidMesh[command->section] = command->liquidMesh;
+        gpu->position = command->position;
+        gpu->hasMesh = true;
+        
+        // Track GPU upload volume (positions, texcoords, light levels and indices)
+        int vertexFloats = shaderLighting? 7 : 5;
+        int vertexCount = command->opaqueMesh.vertexCount + command->transparentMesh.vertexCount + command->liquidMesh.vertexCount;
+        int triangleCount = command->opaqueMesh.triangleCount + command->transparentMesh.triangleCount +
+                            command->liquidMesh.triangleCount;
+        int uploadedBytes = vertexCount*vertexFloats*sizeof(float) + triangleCount*3*sizeof(unsigned short);
+        RenderStatsAddMeshRebuilt(uploadedBytes);
+    }
+    
+    free(command);
+}
+
+// Slot geometry can lag behind the packet while uploads wait for frame budget
+static bool IsGpuMeshDrawable(const ChunkGpuMesh* gpu, const ChunkDrawItem* item) {
+    return gpu->hasMesh && ChunkPosEqual(gpu->position, item->chunkPosition);
+}
+
+// Draw one section mesh, the chunk counts as drawn on its first draw call of the frame
+static void DrawChunkSection(ChunkGpuMesh* gpu, Mesh mesh, Material material, Matrix transform, RenderPass pass) {
+    DrawMesh(mesh, material, transform);
+    RenderStatsAddDrawCall(pass, mesh.vertexCount, mesh.triangleCount);
+    
+    if (gpu->drawnFrame != renderFrame) {
+        gpu->drawnFrame = renderFrame;
+        RenderStatsAddChunkDrawn();
+    }
+}
+
+static void BuildChunkMeshJob(void* userData) {
+    MeshJob* job = (MeshJob*)userData;
+    
+    // Cancelled while queued or between sections: finish without doing the rest
+    for (int s = 0; s < CHUNK_SECTIONS; s++) {
+        if (!(job->sections & (1u << s)) || AtomicLoad(&job->cancelled)) continue;
+        BuildChunkMesh(&job->neighborhood, s, &job->opaqueMeshes[s], &job->transparentMeshes[s], &job->liquidMeshes[s],
+                       &job->cancelled);
+    }
+    AtomicStore(&job->done, 1);
+}
+
+static void RecordMeshJobVersions(MeshJob* job) {
+    job->versions[0] = job->neighborhood.center->version;
+    for (int i = 0; i < CHUNK_NEIGHBORS; i++) {
+        Chunk* neighbor = job->neighborhood.neighbors[i];
+        job->versions[i + 1] = neighbor? neighbor->version : 0;
+    }
+}
+
+// Check the chunks a job reads were not edited since it was submitted
+static bool IsMeshJobCurrent(MeshJob* job) {
+    if (job->neighborhood.center->version != job->versions[0]) return false;
+    for (int i = 0; i < CHUNK_NEIGHBORS; i++) {
+        Chunk* neighbor = job->neighborhood.neighbors[i];
+        if (neighbor && (neighbor->version != job->versions[i + 1])) return false;
+    }
+    return true;
+}
+
+static int CompareDrawItems(const void* a, const void* b) {
+    float distA = ((const ChunkDrawItem*)a)->distance;
+    float distB = ((const ChunkDrawItem*)b)->distance;
+    return (distA > distB) - (distA < distB);
+}
+
 //----------------------------------------------------------------------------------
 // Rendering Functions
 //----------------------------------------------------------------------------------
+// NOTE: The materials share the shaders, the atlas and the lightmap, free their parts instead of UnloadMaterial()
+static void UnloadGlobalMaterials(void) {
+    RL_FREE(globalOpaqueMaterial.maps);
+    RL_FREE(globalTransparentMaterial.maps);
+    RL_FREE(globalLiquidMaterial.maps);
+    globalOpaqueMaterial = (Material){0};
+    globalTransparentMaterial = (Material){0};
+    globalLiquidMaterial = (Material){0};
+    
+    if (liquidShading) UnloadShader(liquidShader);
+    liquidShader = (Shader){0};
+    liquidShading = false;
+    
+    if (shaderLighting) {
+        UnloadShader(chunkShader);
+        UnloadTexture(lightmap);
+    }
+    chunkShader = (Shader){0};
+    lightmap = (Texture2D){0};
+    shaderLighting = false;
+    textureArrayEnabled = false;
+    materialsInitialized = false;
+}
+
+// Chunk shader (shaders/glslXXX/<shaderName>.vs/.fs) and lightmap, false leaves daylight baked into the meshes
+static bool LoadChunkShader(const char* shaderName) {
+    char vsPath[256];
+    char fsPath[256];
+    char lightmapPath[256];
+    bool filesFound = FindResourcePath(TextFormat("shaders/glsl%i/%s.vs", GLSL_VERSION, shaderName), vsPath, sizeof(vsPath)) &&
+                      FindResourcePath(TextFormat("shaders/glsl%i/%s.fs", GLSL_VERSION, shaderName), fsPath, sizeof(fsPath)) &&
+                      FindResourcePath("optifine/lightmap/world0.png", lightmapPath, sizeof(lightmapPath));
+    if (!filesFound) {
+        printf("Voxel renderer: %s shader or lightmap not found\n", shaderName);
+        return false;
+    }
+    
+    chunkShader = LoadShader(vsPath, fsPath);
+    if (chunkShader.id == 0 || chunkShader.id == rlGetShaderIdDefault()) {
+        printf("Voxel renderer: %s shader failed to load\n", shaderName);
+        chunkShader = (Shader){0};
+        return false;
+    }
+    daylightLoc = GetShaderLocation(chunkShader, "daylight");
+    
+    // Filtered, so light levels between texel rows blend smoothly
+    lightmap = LoadTexture(lightmapPath);
+    SetTextureFilter(lightmap, TEXTURE_FILTER_BILINEAR);
+    shaderLighting = true;
+    return true;
+}
+
+// Liquid shader (shaders/glslXXX/liquid.vs/.fs), reads the lightmap and animation table of the chunk shader
+static bool LoadLiquidShader(void) {
+    char vsPath[256];
+    char fsPath[256];
+    bool filesFound = FindResourcePath(TextFormat("shaders/glsl%i/liquid.vs", GLSL_VERSION), vsPath, sizeof(vsPath)) &&
+                      FindResourcePath(TextFormat("shaders/glsl%i/liquid.fs", GLSL_VERSION), fsPath, sizeof(fsPath));
+    if (!filesFound) {
+        printf("Voxel renderer: liquid shader not found\n");
+        return false;
+    }
+    
+    liquidShader = LoadShader(vsPath, fsPath);
+    if (liquidShader.id == 0 || liquidShader.id == rlGetShaderIdDefault()) {
+        printf("Voxel renderer: liquid shader failed to load\n");
+        liquidShader = (Shader){0};
+        return false;
+    }
+    liquidDaylightLoc = GetShaderLocation(liquidShader, "daylight");
+    liquidTicksLoc = GetShaderLocation(liquidShader, "animationTicks");
+    SetShaderValueV(liquidShader, GetShaderLocation(liquidShader, "animations"), textureAnimations, SHADER_UNIFORM_VEC4,
+                    MAX_TEXTURE_ANIMATIONS);
+    return true;
+}
+
+// Texcoord rect the mesher writes per texture index (u, v, width, height): the atlas slot, or on the
+// texture array path the whole tile with the layer folded into v (decoded per vertex by chunk_array.vs)
+// NOTE: With a chunk shader, animated textures also fold their animation id into u
+static void InitMeshTexCoords(void) {
+    for (int i = 0; i < MAX_BLOCK_TEXTURES; i++) {
+        if (textureArrayEnabled) {
+            meshTexCoords[i][0] = 0.0f;
+            meshTexCoords[i][1] = i*TEXTURE_LAYER_STRIDE;
+            meshTexCoords[i][2] = 1.0f;
+            meshTexCoords[i][3] = 1.0f;
+        } else {
+            memcpy(meshTexCoords[i], textureManager.texCoords[i], sizeof(meshTexCoords[i]));
+        }
+        if (shaderLighting) meshTexCoords[i][0] += textureAnimationIds[i]*TEXTURE_ANIMATION_STRIDE;
+    }
+}
+
+// Bind the block array on its own unit, DrawMesh() only rebinds the material maps (0 unbinds)
+static void BindBlockTextureArray(unsigned int id) {
+#if defined(BLOCK_TEXTURE_ARRAY)
+    rlActiveTextureSlot(TEXTURE_ARRAY_UNIT);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, id);
+    rlActiveTextureSlot(0);
+#endif
+}
+
 void InitGlobalMaterials(void) {
-    if (materialsInitialized) {
-        // Clean up existing materials
-        UnloadMaterial(globalOpaqueMaterial);
-        UnloadMaterial(globalTransparentMaterial);
+    if (materialsInitialized) UnloadGlobalMaterials();
+    
+    // Texture array first (it needs its own shader), then the atlas shader, then baked lighting
+    textureArrayEnabled = (blockTextureArray != 0) && LoadChunkShader("chunk_array");
+    if (textureArrayEnabled) {
+        int unit = TEXTURE_ARRAY_UNIT;
+        SetShaderValue(chunkShader, GetShaderLocation(chunkShader, "blockTextures"), &unit, SHADER_UNIFORM_INT);
+    } else {
+        UnloadBlockTextureArray();
+        if (!LoadChunkShader("chunk")) printf("Voxel renderer: baking daylight into meshes\n");
+    }
+    
+    // Animation frames are picked in the shader from the tick clock, the table never changes after this
+    if (shaderLighting) {
+        SetShaderValueV(chunkShader, GetShaderLocation(chunkShader, "animations"), textureAnimations, SHADER_UNIFORM_VEC4,
+                        MAX_TEXTURE_ANIMATIONS);
+        animationTicksLoc = GetShaderLocation(chunkShader, "animationTicks");
     }
     
+    // Liquid faces keep the light levels of the chunk shader, with baked lighting they stay plain transparent faces
+    liquidShading = shaderLighting && LoadLiquidShader();
+    InitMeshTexCoords();
+    
     // Create opaque material
     globalOpaqueMaterial = LoadMaterialDefault();
     if (textureManager.atlas.id > 0) {
@@ -111,270 +772,924 @@ void InitGlobalMaterials(void) {
         globalTransparentMaterial.maps[MATERIAL_MAP_DIFFUSE].color = (Color){255, 255, 255, 255};
     }
     
+    if (shaderLighting) {
+        globalOpaqueMaterial.shader = chunkShader;
+        globalOpaqueMaterial.maps[MATERIAL_MAP_METALNESS].texture = lightmap;      // Bound as texture1
+        globalTransparentMaterial.shader = chunkShader;
+        globalTransparentMaterial.maps[MATERIAL_MAP_METALNESS].texture = lightmap;
+    }
+    
+    // Create liquid material, always on the atlas: the shader wraps the tile coords inside the slot itself
+    if (liquidShading) {
+        globalLiquidMaterial = LoadMaterialDefault();
+        if (textureManager.atlas.id > 0) {
+            SetMaterialTexture(&globalLiquidMaterial, MATERIAL_MAP_DIFFUSE, textureManager.atlas);
+            globalLiquidMaterial.maps[MATERIAL_MAP_DIFFUSE].color = (Color){255, 255, 255, 255};
+        }
+        globalLiquidMaterial.shader = liquidShader;
+        globalLiquidMaterial.maps[MATERIAL_MAP_METALNESS].texture = lightmap;
+    }
+    
     materialsInitialized = true;
 }
 
+// Derive the corner sample deltas from the face corners: a corner on the high side of a tangent axis
+// samples the next cell along it, on the low side the previous one
+static void InitAmbientOcclusion(void) {
+    const int strides[3] = { PADDED_STRIDE_X, PADDED_STRIDE_Y, PADDED_STRIDE_Z };
+    
+    for (int face = 0; face < 6; face++) {
+        int normalAxis = (faceOffsets[face].x != 0)? 0 : (faceOffsets[face].y != 0)? 1 : 2;
+        int tangentA = (normalAxis == 0)? 1 : 0;
+        int tangentB = (normalAxis == 2)? 1 : 2;
+        
+        for (int i = 0; i < 4; i++) {
+            const float corner[3] = { faceVertices[face][i].x, faceVertices[face][i].y, faceVertices[face][i].z };
+            int sideA = ((corner[tangentA] > 0.5f)? 1 : -1)*strides[tangentA];
+            int sideB = ((corner[tangentB] > 0.5f)? 1 : -1)*strides[tangentB];
+            
+            aoSampleDeltas[face][i][0] = sideA;
+            aoSampleDeltas[face][i][1] = sideB;
+            aoSampleDeltas[face][i][2] = sideA + sideB;
+        }
+    }
+}
+
+// Derive the face neighbor deltas from the face UVs (texture right runs from corner 0 to 1, up from 0 to 3)
+// and resolve every connection mask to the tile with the same edges and inner corner seams
+static void InitConnectedTextures(void) {
+    for (int face = 0; face < 6; face++) {
+        Vector3 rightAxis = Vector3Subtract(faceVertices[face][1], faceVertices[face][0]);
+        Vector3 upAxis = Vector3Subtract(faceVertices[face][3], faceVertices[face][0]);
+        int right = (int)rightAxis.x*PADDED_STRIDE_X + (int)rightAxis.y*PADDED_STRIDE_Y + (int)rightAxis.z*PADDED_STRIDE_Z;
+        int up = (int)upAxis.x*PADDED_STRIDE_X + (int)upAxis.y*PADDED_STRIDE_Y + (int)upAxis.z*PADDED_STRIDE_Z;
+        
+        const int deltas[8] = { up, -up, -right, right, up - right, up + right, -up - right, -up + right };
+        memcpy(ctmNeighborDeltas[face], deltas, sizeof(deltas));
+    }
+    
+    const int cornerEdges[4] = { CTM_UP | CTM_LEFT, CTM_UP | CTM_RIGHT, CTM_DOWN | CTM_LEFT, CTM_DOWN | CTM_RIGHT };
+    for (int mask = 0; mask < 256; mask++) {
+        int shape = mask & 0x0F;
+        for (int corner = 0; corner < 4; corner++) {
+            int cornerBit = CTM_UP_LEFT << corner;
+            if (((mask & cornerEdges[corner]) == cornerEdges[corner]) && !(mask & cornerBit)) shape |= cornerBit;
+        }
+        
+        for (int tile = 0; tile < CTM_TILE_COUNT; tile++) {
+            if (ctmTileShapes[tile] == shape) ctmTiles[mask] = (unsigned char)tile;
+        }
+    }
+}
+
 void InitVoxelRenderer(void) {
+    InitAmbientOcclusion();
+    InitConnectedTextures();
     InitTextureManager();
     LoadBlockTextures();
+    LoadBiomeColormaps();
     InitGlobalMaterials();
     
+    memset(chunkMeshes, 0, sizeof(chunkMeshes));
+    memset(meshSlots, 0, sizeof(meshSlots));
+    memset(meshJobs, 0, sizeof(meshJobs));
+    
     // Enable depth testing for proper 3D rendering
     // Alpha blending is handled automatically by raylib when textures have alpha
 }
 
-void RenderVoxelWorld(VoxelWorld* world, Camera3D camera) {
+void BuildRenderPacket(RenderPacket* packet, VoxelWorld* world, Camera3D camera) {
+    packet->camera = camera;
+    packet->daylight = GetDaylight(world->timeOfDay);
+    packet->animationTicks = (float)(world->tickCount % DAY_LENGTH_TICKS);
+    packet->drawCount = 0;
+    memset(&packet->stats, 0, sizeof(packet->stats));
+    
+    // NOTE: Commands are appended, never reset here: if the main thread has not consumed
+    // the previous batch yet, pending uploads/releases must still reach the GPU in order
+    
+    // Collect mesh jobs: upload current results, drop stale ones and cancel doomed work
+    for (int i = 0; i < MAX_CHUNKS; i++) {
+        MeshJob* job = &meshJobs[i];
+        if (!job->inFlight) continue;
+        
+        Chunk* chunk = &world->chunks[i];
+        bool sameChunk = chunk->isLoaded && ChunkPosEqual(chunk->position, job->position);
+        bool current = sameChunk && IsMeshJobCurrent(job);
+        
+        if (!AtomicLoad(&job->done)) {
+            // Chunk unloaded or edited since submission: result would be dropped anyway
+            if (!current && !job->cancelled) {
+                AtomicStore(&job->cancelled, 1);
+                packet->stats.jobsCancelled++;
+            }
+            continue;
+        }
+        
+        ReleaseChunkNeighborhood(&job->neighborhood);
+        job->inFlight = false;
+        
+        if (current && !job->cancelled) {
+            for (int s = 0; s < CHUNK_SECTIONS; s++) {
+                if (!(job->sections & (1u << s))) continue;
+                
+                PushRenderCommand(packet, (RenderCommand){ .type = RENDER_COMMAND_UPLOAD_MESH, .chunkIndex = i,
+                                                           .position = job->position, .section = s,
+                                                           .opaqueMesh = job->opaqueMeshes[s],
+                                                           .transparentMesh = job->transparentMeshes[s],
+                                                           .liquidMesh = job->liquidMeshes[s] });
+                job->opaqueMeshes[s] = (Mesh){0};
+                job->transparentMeshes[s] = (Mesh){0};
+                job->liquidMeshes[s] = (Mesh){0};
+            }
+            meshSlots[i].position = job->position;
+            meshSlots[i].valid = true;
+        } else {
+            if (!job->cancelled) packet->stats.staleMeshesDropped++;
+            FreeJobMeshes(job);
+            
+            // Edited chunk still needs a mesh matching its latest content
+            if (sameChunk) chunk->dirtySections |= job->sections;
+        }
+    }
+    
+    // Release GPU meshes of slots whose chunk got unloaded or replaced
+    for (int i = 0; i < MAX_CHUNKS; i++) {
+        Chunk* chunk = &world->chunks[i];
+        if (meshSlots[i].valid && (!chunk->isLoaded || !ChunkPosEqual(chunk->position, meshSlots[i].position))) {
+            PushRenderCommand(packet, (RenderCommand){ .type = RENDER_COMMAND_RELEASE_MESH, .chunkIndex = i });
+            meshSlots[i].valid = false;
+        }
+    }
+    
     // Update chunk visibility based on frustum culling
     FrustumCullChunks(world, camera);
     
-    // Update chunk meshes that need regeneration
+    // Submit mesh jobs for visible chunks that need regeneration
+    // NOTE: Jobs only read the pinned neighborhood, never the world chunk table
+    JobDecl jobs[MAX_CHUNKS];
+    int jobCount = 0;
+    int pendingMeshes = 0;
     for (int i = 0; i < MAX_CHUNKS; i++) {
-        if (world->chunks[i].isLoaded && world->chunks[i].needsRegen) {
-            UpdateChunkMesh(&world->chunks[i], world);
+        Chunk* chunk = &world->chunks[i];
+        if (meshJobs[i].inFlight) pendingMeshes++;
+        if (!chunk->isLoaded || (AtomicLoad(&chunk->genState) != CHUNK_GEN_READY)) continue;
+        
+        if (!chunk->isVisible) {
+            packet->stats.chunksFrustumCulled++;
+            continue;
+        }
+        
+        if (chunk->dirtySections && !meshJobs[i].inFlight) {
+            MeshJob* job = &meshJobs[i];
+            AcquireChunkNeighborhood(world, chunk, &job->neighborhood);
+            RecordMeshJobVersions(job);
+            job->position = chunk->position;
+            job->sections = chunk->dirtySections;
+            job->cancelled = 0;
+            job->done = 0;
+            job->inFlight = true;
+            jobs[jobCount++] = (JobDecl){ BuildChunkMeshJob, job };
+            
+            chunk->dirtySections = 0;
+            pendingMeshes++;
         }
     }
     
-    // Sort chunks by distance for transparent rendering
-    SortChunksByDistance(world, camera.position);
+    if (jobCount > 0) RunJobs(jobs, jobCount, &meshJobCounter);
     
-    // First pass: Render opaque blocks (front to back for Z-buffer efficiency)
+    packet->stats.generationQueueDepth = AtomicLoad(&world->generationJobs.value);
+    packet->stats.jobsCancelled += world->generationsCancelled;
+    world->generationsCancelled = 0;
+    packet->stats.meshingQueueDepth = pendingMeshes;
+    
+    // Record visible chunks and sort them by distance (front to back)
     for (int i = 0; i < MAX_CHUNKS; i++) {
-        if (world->chunks[i].isLoaded && world->chunks[i].isVisible && world->chunks[i].hasMesh) {
-            if (world->chunks[i].vertexCount > 0) {
-                Vector3 chunkWorldPos = ChunkToWorld(world->chunks[i].position);
-                Matrix transform = MatrixTranslate(chunkWorldPos.x, chunkWorldPos.y, chunkWorldPos.z);
-                DrawMesh(world->chunks[i].mesh, world->chunks[i].material, transform);
-            }
+        Chunk* chunk = &world->chunks[i];
+        if (!chunk->isLoaded || !chunk->isVisible || !meshSlots[i].valid) continue;
+        
+        ChunkDrawItem* item = &packet->drawList[packet->drawCount++];
+        item->chunkIndex = i;
+        item->chunkPosition = chunk->position;
+        item->position = ChunkToWorld(chunk->position);
+        item->distance = Distance2D(camera.position, item->position);
+    }
+    
+    qsort(packet->drawList, packet->drawCount, sizeof(ChunkDrawItem), CompareDrawItems);
+}
+
+void WaitForMeshJobs(void) {
+    WaitForCounter(&meshJobCounter);
+    
+    for (int i = 0; i < MAX_CHUNKS; i++) {
+        MeshJob* job = &meshJobs[i];
+        if (!job->inFlight) continue;
+        
+        ReleaseChunkNeighborhood(&job->neighborhood);
+        FreeJobMeshes(job);
+        job->inFlight = false;
+    }
+}
+
+void UnloadRenderPacket(RenderPacket* packet) {
+    // Free geometry of uploads that were never executed
+    for (int i = 0; i < packet->commandCount; i++) {
+        if (packet->commands[i].type == RENDER_COMMAND_UPLOAD_MESH) {
+            FreeMeshData(&packet->commands[i].opaqueMesh);
+            FreeMeshData(&packet->commands[i].transparentMesh);
+            FreeMeshData(&packet->commands[i].liquidMesh);
         }
     }
     
+    free(packet->commands);
+    *packet = (RenderPacket){0};
+}
+
+void SubmitRenderCommands(RenderPacket* packet) {
+    // Texture reloads touch GL, so they must happen here and never on the simulation thread
+    ValidateTextureManager();
+    
+    // Uploads and releases of a slot must stay ordered, so they all share one priority (FIFO)
+    for (int i = 0; i < packet->commandCount; i++) {
+        RenderCommand* command = (RenderCommand*)malloc(sizeof(RenderCommand));
+        *command = packet->commands[i];
+        ScheduleFrameTask(FRAME_TASK_NORMAL, ExecuteRenderCommandTask, command);
+    }
+    packet->commandCount = 0;
+    
+    RenderStatsMerge(&packet->stats);
+}
+
+void RenderVoxelWorld(const RenderPacket* packet) {
+    // Time of day only moves the lightmap column, chunk meshes stay untouched
+    if (shaderLighting) {
+        SetShaderValue(chunkShader, daylightLoc, &packet->daylight, SHADER_UNIFORM_FLOAT);
+        SetShaderValue(chunkShader, animationTicksLoc, &packet->animationTicks, SHADER_UNIFORM_FLOAT);
+    }
+    if (textureArrayEnabled) BindBlockTextureArray(blockTextureArray);
+    renderFrame++;
+    
+    // First pass: Render opaque blocks (front to back for Z-buffer efficiency)
+    for (int i = 0; i < packet->drawCount; i++) {
+        const ChunkDrawItem* item = &packet->drawList[i];
+        ChunkGpuMesh* gpu = &chunkMeshes[item->chunkIndex];
+        if (!IsGpuMeshDrawable(gpu, item)) continue;
+        
+        Matrix transform = MatrixTranslate(item->position.x, item->position.y, item->position.z);
+        for (int s = 0; s < CHUNK_SECTIONS; s++) {
+            if (gpu->mesh[s].vertexCount == 0) continue;
+            
+            DrawChunkSection(gpu, gpu->mesh[s], globalOpaqueMaterial, transform, RENDER_PASS_OPAQUE);
+        }
+    }
+    
+    // Sections of a chunk from farthest to nearest along the camera height (transparent pass)
+    int cameraSection = (int)floorf(packet->camera.position.y/CHUNK_SECTION_HEIGHT);
+    if (cameraSection < 0) cameraSection = 0;
+    if (cameraSection > CHUNK_SECTIONS - 1) cameraSection = CHUNK_SECTIONS - 1;
+    
+    int sectionOrder[CHUNK_SECTIONS];
+    int orderCount = 0;
+    for (int s = 0; s < cameraSection; s++) sectionOrder[orderCount++] = s;
+    for (int s = CHUNK_SECTIONS - 1; s >= cameraSection; s--) sectionOrder[orderCount++] = s;
+    
     // Second pass: Render transparent blocks (back to front for proper alpha blending)
     // Enable alpha blending and disable depth writing for transparent objects
     rlSetBlendMode(BLEND_ALPHA);
     rlSetBlendFactors(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD);
     
-    for (int i = MAX_CHUNKS - 1; i >= 0; i--) {  // Reverse order for back-to-front
-        if (world->chunks[i].isLoaded && world->chunks[i].isVisible && world->chunks[i].hasMesh) {
-            if (world->chunks[i].transparentVertexCount > 0) {
-                Vector3 chunkWorldPos = ChunkToWorld(world->chunks[i].position);
-                Matrix transform = MatrixTranslate(chunkWorldPos.x, chunkWorldPos.y, chunkWorldPos.z);
-                
-                // Disable depth writing for transparent objects but keep depth testing
-                rlDisableDepthMask();
-                DrawMesh(world->chunks[i].transparentMesh, world->chunks[i].transparentMaterial, transform);
-                rlEnableDepthMask();
-            }
+    for (int i = packet->drawCount - 1; i >= 0; i--) {  // Reverse order for back-to-front
+        const ChunkDrawItem* item = &packet->drawList[i];
+        ChunkGpuMesh* gpu = &chunkMeshes[item->chunkIndex];
+        
+        if (!IsGpuMeshDrawable(gpu, item)) continue;
+        
+        Matrix transform = MatrixTranslate(item->position.x, item->position.y, item->position.z);
+        for (int k = 0; k < CHUNK_SECTIONS; k++) {
+            const Mesh* mesh = &gpu->transparentMesh[sectionOrder[k]];
+            if (mesh->vertexCount == 0) continue;
+            
+            // Disable depth writing for transparent objects but keep depth testing
+            rlDisableDepthMask();
+            DrawChunkSection(gpu, *mesh, globalTransparentMaterial, transform, RENDER_PASS_TRANSPARENT);
+            rlEnableDepthMask();
+        }
+    }
+    
+    // Third pass: Render liquids (back to front), both sides so the surface also shows from underwater
+    if (liquidShading) {
+        SetShaderValue(liquidShader, liquidDaylightLoc, &packet->daylight, SHADER_UNIFORM_FLOAT);
+        SetShaderValue(liquidShader, liquidTicksLoc, &packet->animationTicks, SHADER_UNIFORM_FLOAT);
+    }
+    Material liquidMaterial = liquidShading? globalLiquidMaterial : globalTransparentMaterial;
+    rlDisableBackfaceCulling();
+    rlDisableDepthMask();
+    
+    for (int i = packet->drawCount - 1; i >= 0; i--) {
+        const ChunkDrawItem* item = &packet->drawList[i];
+        ChunkGpuMesh* gpu = &chunkMeshes[item->chunkIndex];
+        
+        if (!IsGpuMeshDrawable(gpu, item)) continue;
+        
+        Matrix transform = MatrixTranslate(item->position.x, item->position.y, item->position.z);
+        for (int k = 0; k < CHUNK_SECTIONS; k++) {
+            const Mesh* mesh = &gpu->liquidMesh[sectionOrder[k]];
+            if (mesh->vertexCount == 0) continue;
+            
+            DrawChunkSection(gpu, *mesh, liquidMaterial, transform, RENDER_PASS_LIQUID);
         }
     }
     
+    rlEnableDepthMask();
+    rlEnableBackfaceCulling();
+    
     // Reset blend mode to normal
     rlSetBlendMode(BLEND_ALPHA);
+    if (textureArrayEnabled) BindBlockTextureArray(0);
 }
 
-void RenderChunk(Chunk* chunk, Camera3D camera) {
-    // This function is now handled by RenderVoxelWorld for proper depth sorting
-    // Keeping for compatibility but not used in the new rendering pipeline
-    if (!chunk->hasMesh) return;
+void UnloadVoxelRenderer(void) {
+    // Release all chunk GPU meshes
+    for (int i = 0; i < MAX_CHUNKS; i++) ReleaseChunkGpuMesh(i);
+    memset(meshSlots, 0, sizeof(meshSlots));
     
-    Vector3 chunkWorldPos = ChunkToWorld(chunk->position);
-    Matrix transform = MatrixTranslate(chunkWorldPos.x, chunkWorldPos.y, chunkWorldPos.z);
+    // Clean up global materials
+    if (materialsInitialized) UnloadGlobalMaterials();
     
-    // Draw opaque mesh
-    if (chunk->vertexCount > 0) {
-        DrawMesh(chunk->mesh, chunk->material, transform);
-    }
+    UnloadBiomeColormaps();
+    UnloadTextureManager();
+}
+
+//----------------------------------------------------------------------------------
+// Mesh Generation Functions
+//----------------------------------------------------------------------------------
+// NOTE: CPU only, runs on a job worker; the main thread uploads the result
+// Quads of a non-cube block model (corner order as faceVertices), with their indices
+static void AddQuadsToMesh(Vector3 position, const Vector3 (*quads)[4], int quadCount, int textureIndex,
+                           float* vertices, float* texCoords, unsigned short* indices, int* vertexIndex, int* indexIndex) {
+    float u = meshTexCoords[textureIndex][0];
+    float v = meshTexCoords[textureIndex][1];
+    float w = meshTexCoords[textureIndex][2];
+    float h = meshTexCoords[textureIndex][3];
     
-    // Draw transparent mesh with alpha blending
-    if (chunk->transparentVertexCount > 0) {
-        rlSetBlendMode(BLEND_ALPHA);
-        DrawMesh(chunk->transparentMesh, chunk->transparentMaterial, transform);
-        rlSetBlendMode(BLEND_ALPHA);
+    for (int quad = 0; quad < quadCount; quad++) {
+        unsigned short baseIndex = (unsigned short)*vertexIndex;
+        
+        for (int i = 0; i < 4; i++) {
+            Vector3 vertex = Vector3Add(position, quads[quad][i]);
+            
+            vertices[(*vertexIndex) * 3 + 0] = vertex.x;
+            vertices[(*vertexIndex) * 3 + 1] = vertex.y;
+            vertices[(*vertexIndex) * 3 + 2] = vertex.z;
+            
+            texCoords[(*vertexIndex) * 2 + 0] = u + faceUVs[i].x * w;
+            texCoords[(*vertexIndex) * 2 + 1] = v + faceUVs[i].y * h;
+            
+            (*vertexIndex)++;
+        }
+        
+        indices[(*indexIndex)++] = baseIndex;
+        indices[(*indexIndex)++] = baseIndex + 1;
+        indices[(*indexIndex)++] = baseIndex + 2;
+        indices[(*indexIndex)++] = baseIndex;
+        indices[(*indexIndex)++] = baseIndex + 2;
+        indices[(*indexIndex)++] = baseIndex + 3;
+    }
+}
+
+// Vertex light from averaged levels (scaled so 255 is level 15), an AO brightness scale and the biome tint
+// NOTE: Baked colors assume full daylight, the day/night cycle needs the chunk shader
+static void PackVertexLight(unsigned char* colors, float* lightLevels, int vertex, int skyLight, int blockLight, int ao,
+                            Color tint) {
+    unsigned char* color = &colors[vertex*4];
+    if (shaderLighting) {
+        lightLevels[vertex*2 + 0] = skyLight/255.0f;
+        lightLevels[vertex*2 + 1] = blockLight/255.0f;
+        color[0] = tint.r;
+        color[1] = tint.g;
+        color[2] = tint.b;
+        color[3] = (unsigned char)ao;
+    } else {
+        int level = (((skyLight > blockLight)? skyLight : blockLight) + 8)/17;
+        int brightness = lightBrightness[level]*ao/255;
+        color[0] = (unsigned char)(tint.r*brightness/255);
+        color[1] = (unsigned char)(tint.g*brightness/255);
+        color[2] = (unsigned char)(tint.b*brightness/255);
+        color[3] = 255;
+    }
+}
+
+// Light vertices [firstVertex, endVertex) with the levels of one padded cell, untinted
+static void SetVertexLight(unsigned char* colors, float* lightLevels, int firstVertex, int endVertex,
+                           const SectionPadding* padding, int cell) {
+    for (int i = firstVertex; i < endVertex; i++) {
+        PackVertexLight(colors, lightLevels, i, padding->skyLight[cell]*17, padding->blockLight[cell]*17, 255, WHITE);
     }
 }
 
-void UpdateChunkMesh(Chunk* chunk, VoxelWorld* world) {
-    if (!chunk->needsRegen) return;
+// Colormap color of a climate, the humidity axis is scaled by temperature (the colormap triangle)
+static Color SampleColormap(const BiomeColormap* colormap, ColumnClimate climate) {
+    if (!colormap->colors) return colormap->fallback;
     
-    // Generate new mesh
-    GenerateChunkMesh(chunk, world);
-    chunk->needsRegen = false;
+    int temperature = climate.temperature;
+    int humidity = climate.humidity*temperature/255;
+    int x = (255 - temperature)*(colormap->width - 1)/255;
+    int y = (255 - humidity)*(colormap->height - 1)/255;
+    return colormap->colors[y*colormap->width + x];
 }
 
-void UnloadVoxelRenderer(void) {
-    // Clean up global materials
-    if (materialsInitialized) {
-        UnloadMaterial(globalOpaqueMaterial);
-        UnloadMaterial(globalTransparentMaterial);
-        materialsInitialized = false;
+// Sample the colormaps once per column of the section and its border, then blend the 4 columns around each corner
+static void FillCornerTints(const ChunkNeighborhood* neighborhood, SectionPadding* padding) {
+    Color columnTints[TINT_KINDS][PADDED_SIZE][PADDED_SIZE];
+    
+    for (int px = 0; px < PADDED_SIZE; px++) {
+        for (int pz = 0; pz < PADDED_SIZE; pz++) {
+            ColumnClimate climate = GetNeighborhoodClimate(neighborhood, px - 1, pz - 1);
+            columnTints[TINT_GRASS][px][pz] = SampleColormap(&colormaps[climate.swamp? COLORMAP_SWAMP_GRASS : COLORMAP_GRASS], climate);
+            columnTints[TINT_FOLIAGE][px][pz] = SampleColormap(&colormaps[climate.swamp? COLORMAP_SWAMP_FOLIAGE : COLORMAP_FOLIAGE], climate);
+            columnTints[TINT_BIRCH][px][pz] = SampleColormap(&colormaps[COLORMAP_BIRCH], climate);
+        }
     }
     
-    UnloadTextureManager();
+    // Corner (x, z) touches padded columns x and x + 1 on each axis
+    for (int kind = 0; kind < TINT_KINDS; kind++) {
+        for (int x = 0; x <= CHUNK_SIZE; x++) {
+            for (int z = 0; z <= CHUNK_SIZE; z++) {
+                Color a = columnTints[kind][x][z];
+                Color b = columnTints[kind][x + 1][z];
+                Color c = columnTints[kind][x][z + 1];
+                Color d = columnTints[kind][x + 1][z + 1];
+                padding->cornerTints[kind][x][z] = (Color){
+                    (unsigned char)((a.r + b.r + c.r + d.r + 2)/4),
+                    (unsigned char)((a.g + b.g + c.g + d.g + 2)/4),
+                    (unsigned char)((a.b + b.b + c.b + d.b + 2)/4),
+                    255 };
+            }
+        }
+    }
+    
+    padding->tintsReady = true;
 }
 
-//----------------------------------------------------------------------------------
-// Mesh Generation Functions
-//----------------------------------------------------------------------------------
-void GenerateChunkMesh(Chunk* chunk, VoxelWorld* world) {
-    // Free existing mesh geometry if it exists, but KEEP materials
-    if (chunk->hasMesh) {
-        // Unload opaque mesh geometry only
-        if (chunk->vertexCount > 0) {
-            UnloadMesh(chunk->mesh);
+// Colormap tinting a block face (grayscale textures), TINT_NONE for fixed textures
+static BiomeTint GetBlockTint(BlockType block, int faceIndex) {
+    switch (block) {
+        case BLOCK_GRASS: return (faceIndex == FACE_TOP)? TINT_GRASS : TINT_NONE;
+        case BLOCK_OAK_LEAVES:
+        case BLOCK_ACACIA_LEAVES:
+        case BLOCK_DARK_OAK_LEAVES: return TINT_FOLIAGE;
+        case BLOCK_BIRCH_LEAVES: return TINT_BIRCH;
+        default: return TINT_NONE;
+    }
+}
+
+// Copy the section and its border into the padded buffer, each border column from the chunk that holds it
+// NOTE: Missing chunks read as air in open daylight, as GetNeighborhoodBlock() and GetNeighborhoodLight()
+static void FillSectionPadding(const ChunkNeighborhood* neighborhood, int section, SectionPadding* padding) {
+    int minY = section*CHUNK_SECTION_HEIGHT - 1;
+    padding->tintsReady = false;
+    
+    for (int px = 0; px < PADDED_SIZE; px++) {
+        for (int pz = 0; pz < PADDED_SIZE; pz++) {
+            int x = px - 1;
+            int z = pz - 1;
+            const Chunk* chunk = GetNeighborhoodColumn(neighborhood, &x, &z);
+            
+            // Liquid depth counts on from the cells under the buffer
+            int liquidDepth = 0;
+            for (int y = minY - LIQUID_TINT_DEPTH + 1; chunk && (y < minY); y++) {
+                bool liquid = (y >= 0) && (chunk->blocks[x][y][z] == BLOCK_WATER);
+                liquidDepth = liquid? liquidDepth + 1 : 0;
+            }
+            
+            for (int py = 0; py < PADDED_HEIGHT; py++) {
+                int y = minY + py;
+                int index = px*PADDED_STRIDE_X + py*PADDED_STRIDE_Y + pz*PADDED_STRIDE_Z;
+                BlockType block = BLOCK_AIR;
+                unsigned char data = 0;
+                int skyLight = (y < 0)? 0 : MAX_LIGHT_LEVEL;
+                int blockLight = 0;
+                
+                if (chunk && (y >= 0) && (y < WORLD_HEIGHT)) {
+                    block = chunk->blocks[x][y][z];
+                    data = chunk->blockData[x][y][z];
+                    skyLight = GetChunkLight(chunk, LIGHT_SKY, x, y, z);
+                    blockLight = GetChunkLight(chunk, LIGHT_BLOCK, x, y, z);
+                }
+                
+                liquidDepth = (block == BLOCK_WATER)? liquidDepth + 1 : 0;
+                if (liquidDepth > LIQUID_TINT_DEPTH) liquidDepth = LIQUID_TINT_DEPTH;
+                
+                padding->blocks[index] = block;
+                padding->occluders[index] = (GetBlockLightOpacity(block) == MAX_LIGHT_LEVEL);
+                padding->skyLight[index] = (unsigned char)skyLight;
+                padding->blockLight[index] = (unsigned char)blockLight;
+                padding->blockData[index] = data;
+                padding->liquidDepths[index] = (unsigned char)liquidDepth;
+            }
         }
+    }
+}
+
+// Smooth light, AO and tint of the 4 vertices of a face looking into frontCell, returns the occlusion levels
+static void ShadeFace(const SectionPadding* padding, int frontCell, int face, const Color* tints, unsigned char* colors,
+                      float* lightLevels, int firstVertex, int* occlusion) {
+    for (int i = 0; i < 4; i++) {
+        const int* deltas = aoSampleDeltas[face][i];
+        int sideA = padding->occluders[frontCell + deltas[0]];
+        int sideB = padding->occluders[frontCell + deltas[1]];
+        int corner = padding->occluders[frontCell + deltas[2]];
+        occlusion[i] = aoLevels[sideA | (sideB << 1) | (corner << 2)];
         
-        // Unload transparent mesh geometry only  
-        if (chunk->transparentVertexCount > 0) {
-            UnloadMesh(chunk->transparentMesh);
+        // Average the open cells around the vertex, a hidden corner does not count
+        int skySum = padding->skyLight[frontCell];
+        int blockSum = padding->blockLight[frontCell];
+        int count = 1;
+        for (int k = 0; k < 3; k++) {
+            bool open = (k == 0)? !sideA : (k == 1)? !sideB : (!corner && !(sideA && sideB));
+            if (!open) continue;
+            
+            skySum += padding->skyLight[frontCell + deltas[k]];
+            blockSum += padding->blockLight[frontCell + deltas[k]];
+            count++;
         }
         
-        // Reset counts but keep materials
-        chunk->vertexCount = 0;
-        chunk->triangleCount = 0;
-        chunk->transparentVertexCount = 0;
-        chunk->transparentTriangleCount = 0;
+        PackVertexLight(colors, lightLevels, firstVertex + i, skySum*17/count, blockSum*17/count, aoBrightness[occlusion[i]],
+                        tints[i]);
+    }
+}
+
+// Retexture the 4 vertices of a face added by AddFaceToMesh (state dependent textures)
+static void SetFaceTextureIndex(float* texCoords, int firstVertex, int textureIndex) {
+    for (int i = 0; i < 4; i++) {
+        texCoords[(firstVertex + i) * 2 + 0] = meshTexCoords[textureIndex][0] + faceUVs[i].x * meshTexCoords[textureIndex][2];
+        texCoords[(firstVertex + i) * 2 + 1] = meshTexCoords[textureIndex][1] + faceUVs[i].y * meshTexCoords[textureIndex][3];
     }
+}
+
+// Connection mask of a face: in-plane neighbors of the same block whose own face is not covered
+static int GetConnectionMask(const SectionPadding* padding, int cell, int frontDelta, int face, BlockType block) {
+    int mask = 0;
+    for (int i = 0; i < 8; i++) {
+        int neighbor = cell + ctmNeighborDeltas[face][i];
+        if ((padding->blocks[neighbor] == block) && (padding->blocks[neighbor + frontDelta] != block)) mask |= 1 << i;
+    }
+    return mask;
+}
+
+// Corner heights and depths of a liquid cell from the 3x3 cells around it: each corner averages the liquid cells
+// meeting there, so neighbors share their edges and flowing water slopes instead of stepping
+// NOTE: A corner touching a full cell (liquid above, or falling) rises to the block top to meet that column
+static void GetLiquidCorners(const SectionPadding* padding, int cell, LiquidCorners* corners) {
+    float heights[3][3];
+    float depths[3][3];
+    for (int dx = 0; dx < 3; dx++) {
+        for (int dz = 0; dz < 3; dz++) {
+            int neighbor = cell + (dx - 1)*PADDED_STRIDE_X + (dz - 1)*PADDED_STRIDE_Z;
+            heights[dx][dz] = -1.0f;
+            depths[dx][dz] = (float)padding->liquidDepths[neighbor]/LIQUID_TINT_DEPTH;
+            if (padding->blocks[neighbor] != BLOCK_WATER) continue;
+            
+            bool waterAbove = (padding->blocks[neighbor + PADDED_STRIDE_Y] == BLOCK_WATER);
+            heights[dx][dz] = GetFluidHeight(padding->blockData[neighbor], waterAbove);
+        }
+    }
+    
+    for (int cornerX = 0; cornerX < 2; cornerX++) {
+        for (int cornerZ = 0; cornerZ < 2; cornerZ++) {
+            float heightSum = 0.0f;
+            float depthSum = 0.0f;
+            int liquidCount = 0;
+            bool full = false;
+            for (int i = 0; i < 4; i++) {
+                float height = heights[cornerX + (i & 1)][cornerZ + (i >> 1)];
+                depthSum += depths[cornerX + (i & 1)][cornerZ + (i >> 1)];
+                if (height < 0.0f) continue;
+                
+                full |= (height >= 1.0f);
+                heightSum += height;
+                liquidCount++;
+            }
+            
+            // Dry cells count as zero depth, the tint fades out toward the shore
+            corners->heights[cornerX][cornerZ] = full? 1.0f : heightSum/liquidCount;
+            corners->depths[cornerX][cornerZ] = depthSum/4.0f;
+        }
+    }
+}
+
+// Liquid vertices a and b shade the same (height, color and light levels), faces made of them can merge
+static bool LiquidVerticesMatch(const float* vertices, const unsigned char* colors, const float* lightLevels, int a, int b) {
+    return (vertices[a*3 + 1] == vertices[b*3 + 1]) && (memcmp(&colors[a*4], &colors[b*4], 4) == 0) &&
+           (lightLevels[a*2 + 0] == lightLevels[b*2 + 0]) && (lightLevels[a*2 + 1] == lightLevels[b*2 + 1]);
+}
+
+// Copy the used part of the mesher arrays into a mesh, light levels only with the chunk shader
+static void CopyMeshData(Mesh* mesh, const float* vertices, const float* texCoords, const unsigned char* colors,
+                         const float* lightLevels, const unsigned short* indices, int vertexCount, int indexCount) {
+    mesh->vertexCount = vertexCount;
+    mesh->triangleCount = indexCount / 3;
     
-    // Validate texture atlas before proceeding
-    if (!ValidateTextureManager()) {
-        printf("Error: Cannot generate chunk mesh without valid texture manager\n");
-        return;
-    }
+    mesh->vertices = (float*)RL_MALLOC(vertexCount * 3 * sizeof(float));
+    mesh->texcoords = (float*)RL_MALLOC(vertexCount * 2 * sizeof(float));
+    mesh->colors = (unsigned char*)RL_MALLOC(vertexCount * 4 * sizeof(unsigned char));
+    if (shaderLighting) mesh->texcoords2 = (float*)RL_MALLOC(vertexCount * 2 * sizeof(float));
+    mesh->indices = (unsigned short*)RL_MALLOC(indexCount * sizeof(unsigned short));
+    
+    memcpy(mesh->vertices, vertices, vertexCount * 3 * sizeof(float));
+    memcpy(mesh->texcoords, texCoords, vertexCount * 2 * sizeof(float));
+    memcpy(mesh->colors, colors, vertexCount * 4 * sizeof(unsigned char));
+    if (shaderLighting) memcpy(mesh->texcoords2, lightLevels, vertexCount * 2 * sizeof(float));
+    memcpy(mesh->indices, indices, indexCount * sizeof(unsigned short));
+}
+
+bool BuildChunkMesh(const ChunkNeighborhood* neighborhood, int section, Mesh* opaqueMesh, Mesh* transparentMesh,
+                    Mesh* liquidMesh, volatile int* cancelToken) {
+    const Chunk* chunk = neighborhood->center;
+    
+    *opaqueMesh = (Mesh){0};
+    *transparentMesh = (Mesh){0};
+    *liquidMesh = (Mesh){0};
     
-    // Create separate arrays for opaque and transparent blocks
-    float* opaqueVertices = (float*)malloc(MAX_VERTICES_PER_CHUNK * 3 * sizeof(float));
-    float* opaqueTexCoords = (float*)malloc(MAX_VERTICES_PER_CHUNK * 2 * sizeof(float));
-    unsigned short* opaqueIndices = (unsigned short*)malloc(MAX_TRIANGLES_PER_CHUNK * 3 * sizeof(unsigned short));
+    // Create separate arrays for opaque blocks, transparent blocks and liquids
+    float* opaqueVertices = (float*)malloc(MAX_VERTICES_PER_SECTION * 3 * sizeof(float));
+    float* opaqueTexCoords = (float*)malloc(MAX_VERTICES_PER_SECTION * 2 * sizeof(float));
+    unsigned char* opaqueColors = (unsigned char*)malloc(MAX_VERTICES_PER_SECTION * 4 * sizeof(unsigned char));
+    float* opaqueLight = (float*)malloc(MAX_VERTICES_PER_SECTION * 2 * sizeof(float));
+    unsigned short* opaqueIndices = (unsigned short*)malloc(MAX_TRIANGLES_PER_SECTION * 3 * sizeof(unsigned short));
     
-    float* transparentVertices = (float*)malloc(MAX_VERTICES_PER_CHUNK * 3 * sizeof(float));
-    float* transparentTexCoords = (float*)malloc(MAX_VERTICES_PER_CHUNK * 2 * sizeof(float));
-    unsigned short* transparentIndices = (unsigned short*)malloc(MAX_TRIANGLES_PER_CHUNK * 3 * sizeof(unsigned short));
+    float* transparentVertices = (float*)malloc(MAX_VERTICES_PER_SECTION * 3 * sizeof(float));
+    float* transparentTexCoords = (float*)malloc(MAX_VERTICES_PER_SECTION * 2 * sizeof(float));
+    unsigned char* transparentColors = (unsigned char*)malloc(MAX_VERTICES_PER_SECTION * 4 * sizeof(unsigned char));
+    float* transparentLight = (float*)malloc(MAX_VERTICES_PER_SECTION * 2 * sizeof(float));
+    unsigned short* transparentIndices = (unsigned short*)malloc(MAX_TRIANGLES_PER_SECTION * 3 * sizeof(unsigned short));
+    
+    float* liquidVertices = (float*)malloc(MAX_VERTICES_PER_SECTION * 3 * sizeof(float));
+    float* liquidTexCoords = (float*)malloc(MAX_VERTICES_PER_SECTION * 2 * sizeof(float));
+    unsigned char* liquidColors = (unsigned char*)malloc(MAX_VERTICES_PER_SECTION * 4 * sizeof(unsigned char));
+    float* liquidLight = (float*)malloc(MAX_VERTICES_PER_SECTION * 2 * sizeof(float));
+    unsigned short* liquidIndices = (unsigned short*)malloc(MAX_TRIANGLES_PER_SECTION * 3 * sizeof(unsigned short));
     
     int opaqueVertexIndex = 0;
     int opaqueIndexIndex = 0;
     int transparentVertexIndex = 0;
     int transparentIndexIndex = 0;
+    int liquidVertexIndex = 0;
+    int liquidIndexIndex = 0;
+    int liquidTextures[6] = { -1, -1, -1, -1, -1, -1 };    // Water texture per face, looked up on the first liquid face
+    
+    SectionPadding* padding = (SectionPadding*)malloc(sizeof(SectionPadding));
+    FillSectionPadding(neighborhood, section, padding);
     
-    // Generate faces for each block
+    // Generate faces for each block of the section
+    int minY = section*CHUNK_SECTION_HEIGHT;
+    int maxY = minY + CHUNK_SECTION_HEIGHT;
+    bool cancelled = false;
     for (int x = 0; x < CHUNK_SIZE; x++) {
-        for (int y = 0; y < WORLD_HEIGHT; y++) {
+        // Poll cancellation once per slice, abandoned work stops early
+        if (cancelToken && AtomicLoad(cancelToken)) {
+            cancelled = true;
+            break;
+        }
+        
+        for (int y = minY; y < maxY; y++) {
+            int surfaceRun = -1;        // First vertex of the liquid surface quad the next cell may extend
+            int surfaceRunZ = -1;       // Last cell covered by that quad
+            
             for (int z = 0; z < CHUNK_SIZE; z++) {
                 BlockType block = chunk->blocks[x][y][z];
                 
                 if (block == BLOCK_AIR) continue;
                 
                 Vector3 blockPos = {x, y, z};
+                int cell = (x + 1)*PADDED_STRIDE_X + (y - minY + 1)*PADDED_STRIDE_Y + (z + 1)*PADDED_STRIDE_Z;
+                
+                // Liquids go to their own mesh: the surface and the sides facing air or see-through blocks, never the bottom
+                if (block == BLOCK_WATER) {
+                    LiquidCorners corners;
+                    bool cornersReady = false;
+                    
+                    for (int face = 0; face < 6; face++) {
+                        if (face == FACE_BOTTOM) continue;
+                        
+                        int frontCell = cell + (int)faceOffsets[face].x*PADDED_STRIDE_X + (int)faceOffsets[face].y*PADDED_STRIDE_Y +
+                                        (int)faceOffsets[face].z*PADDED_STRIDE_Z;
+                        BlockType neighborBlock = padding->blocks[frontCell];
+                        if (neighborBlock == BLOCK_WATER) continue;
+                        
+                        // A lowered surface still shows under a solid block, a side against one never does
+                        bool covered = !IsBlockTransparent(neighborBlock);
+                        if (covered && (face != FACE_TOP)) continue;
+                        
+                        if (!cornersReady) {
+                            GetLiquidCorners(padding, cell, &corners);
+                            cornersReady = true;
+                        }
+                        if (covered && (corners.heights[0][0] >= 1.0f) && (corners.heights[0][1] >= 1.0f) &&
+                            (corners.heights[1][0] >= 1.0f) && (corners.heights[1][1] >= 1.0f)) continue;
+                        
+                        // Upper corners follow the surface; with the liquid shader the faces carry tile coords with the
+                        // atlas slot folded into v (wrapped and scrolled by liquid.vs) and the water depth instead of AO
+                        if (liquidTextures[0] < 0) {
+                            for (int i = 0; i < 6; i++) liquidTextures[i] = GetBlockTextureIndex(BLOCK_WATER, i);
+                        }
+                        int textureIndex = liquidTextures[face];
+                        int firstVertex = liquidVertexIndex;
+                        for (int i = 0; i < 4; i++) {
+                            int vertex = firstVertex + i;
+                            Vector3 corner = faceVertices[face][i];
+                            float top = corners.heights[(int)corner.x][(int)corner.z];
+                            
+                            liquidVertices[vertex*3 + 0] = blockPos.x + corner.x;
+                            liquidVertices[vertex*3 + 1] = blockPos.y + ((corner.y > 0.0f)? top : 0.0f);
+                            liquidVertices[vertex*3 + 2] = blockPos.z + corner.z;
+                            
+                            if (liquidShading) {
+                                liquidTexCoords[vertex*2 + 0] = textureAnimationIds[textureIndex]*TEXTURE_ANIMATION_STRIDE + faceUVs[i].x;
+                                liquidTexCoords[vertex*2 + 1] = textureIndex*TEXTURE_LAYER_STRIDE + faceUVs[i].y;
+                            } else {
+                                liquidTexCoords[vertex*2 + 0] = meshTexCoords[textureIndex][0] + faceUVs[i].x*meshTexCoords[textureIndex][2];
+                                liquidTexCoords[vertex*2 + 1] = meshTexCoords[textureIndex][1] + faceUVs[i].y*meshTexCoords[textureIndex][3];
+                            }
+                        }
+                        liquidVertexIndex += 4;
+                        
+                        Color tints[4] = { WHITE, WHITE, WHITE, WHITE };
+                        int occlusion[4];
+                        ShadeFace(padding, frontCell, face, tints, liquidColors, liquidLight, firstVertex, occlusion);
+                        if (liquidShading) {
+                            for (int i = 0; i < 4; i++) {
+                                float depth = corners.depths[(int)faceVertices[face][i].x][(int)faceVertices[face][i].z];
+                                liquidColors[(firstVertex + i)*4 + 3] = (unsigned char)(depth*255.0f);
+                            }
+                        }
+                        
+                        // An evenly shaded surface face stretches the quad of the previous cell instead (corners 0 and 1
+                        // are the +z edge), open water becomes one quad per row
+                        // NOTE: Rows are at most CHUNK_SIZE tiles long, below 3/4 of TEXTURE_LAYER_STRIDE
+                        if ((face == FACE_TOP) && liquidShading) {
+                            bool even = LiquidVerticesMatch(liquidVertices, liquidColors, liquidLight, firstVertex, firstVertex + 1) &&
+                                        LiquidVerticesMatch(liquidVertices, liquidColors, liquidLight, firstVertex, firstVertex + 2) &&
+                                        LiquidVerticesMatch(liquidVertices, liquidColors, liquidLight, firstVertex, firstVertex + 3);
+                            
+                            if (even && (surfaceRun >= 0) && (surfaceRunZ == z - 1) &&
+                                LiquidVerticesMatch(liquidVertices, liquidColors, liquidLight, surfaceRun, firstVertex)) {
+                                for (int i = 0; i < 2; i++) {
+                                    liquidVertices[(surfaceRun + i)*3 + 2] += 1.0f;
+                                    liquidTexCoords[(surfaceRun + i)*2 + 1] += 1.0f;
+                                }
+                                liquidVertexIndex = firstVertex;
+                                surfaceRunZ = z;
+                                continue;
+                            }
+                            
+                            surfaceRun = even? firstVertex : -1;
+                            surfaceRunZ = z;
+                        }
+                        
+                        unsigned short baseIndex = (unsigned short)firstVertex;
+                        int split = (occlusion[0] + occlusion[2] >= occlusion[1] + occlusion[3])? 0 : 1;
+                        
+                        liquidIndices[liquidIndexIndex++] = baseIndex + split;
+                        liquidIndices[liquidIndexIndex++] = baseIndex + split + 1;
+                        liquidIndices[liquidIndexIndex++] = baseIndex + split + 2;
+                        
+                        liquidIndices[liquidIndexIndex++] = baseIndex + split;
+                        liquidIndices[liquidIndexIndex++] = baseIndex + split + 2;
+                        liquidIndices[liquidIndexIndex++] = baseIndex + (split + 3) % 4;
+                    }
+                    continue;
+                }
+                
                 bool isTransparent = BlockNeedsAlphaBlending(block);
                 
                 // Choose the appropriate arrays based on block transparency
                 float* vertices = isTransparent ? transparentVertices : opaqueVertices;
                 float* texCoords = isTransparent ? transparentTexCoords : opaqueTexCoords;
+                unsigned char* colors = isTransparent ? transparentColors : opaqueColors;
+                float* lightLevels = isTransparent ? transparentLight : opaqueLight;
                 unsigned short* indices = isTransparent ? transparentIndices : opaqueIndices;
                 int* vertexIndex = isTransparent ? &transparentVertexIndex : &opaqueVertexIndex;
                 int* indexIndex = isTransparent ? &transparentIndexIndex : &opaqueIndexIndex;
                 
+                // Plants, torches and levers are two crossed quads instead of a cube, lit by their own cell
+                unsigned char data = chunk->blockData[x][y][z];
+                bool powered = (data & REDSTONE_POWERED) != 0;
+                int firstVertex = *vertexIndex;
+                if (block == BLOCK_WHEAT) {
+                    AddCrossToMesh(blockPos, blockTextures.wheatStages[(data <= WHEAT_MAX_STAGE)? data : WHEAT_MAX_STAGE],
+                                   vertices, texCoords, indices, vertexIndex, indexIndex);
+                } else if ((block == BLOCK_REDSTONE_TORCH) || (block == BLOCK_LEVER)) {
+                    int textureIndex = ((block == BLOCK_REDSTONE_TORCH) && !powered)? blockTextures.torchOff : blockTextures.faces[block][FACE_FRONT];
+                    AddCrossToMesh(blockPos, textureIndex, vertices, texCoords, indices, vertexIndex, indexIndex);
+                } else if (block == BLOCK_REDSTONE_WIRE) {
+                    AddQuadsToMesh(blockPos, wireVertices, 1, powered? blockTextures.wirePowered : blockTextures.faces[block][FACE_TOP],
+                                   vertices, texCoords, indices, vertexIndex, indexIndex);
+                }
+                if (*vertexIndex > firstVertex) {
+                    SetVertexLight(colors, lightLevels, firstVertex, *vertexIndex, padding, cell);
+                    continue;
+                }
+                
                 // Check each face of the block
                 for (int face = 0; face < 6; face++) {
-                    BlockPos neighborPos = {
-                        chunk->position.x * CHUNK_SIZE + x + (int)faceOffsets[face].x,
-                        y + (int)faceOffsets[face].y,
-                        chunk->position.z * CHUNK_SIZE + z + (int)faceOffsets[face].z
-                    };
+                    int frontCell = cell + (int)faceOffsets[face].x*PADDED_STRIDE_X + (int)faceOffsets[face].y*PADDED_STRIDE_Y +
+                                    (int)faceOffsets[face].z*PADDED_STRIDE_Z;
+                    BlockType neighborBlock = padding->blocks[frontCell];
+                    
+                    // Faces between panes of the same glass are never visible
+                    if ((block == neighborBlock) && (GetConnectedTextureSet(block) != NULL)) continue;
                     
-                    if (ShouldRenderFace(world, neighborPos, face)) {
+                    // Render face if neighbor is air or transparent
+                    if (IsBlockTransparent(neighborBlock)) {
                         AddFaceToMesh(blockPos, face, block, vertices, texCoords, vertexIndex);
                         
-                        // Add indices for two triangles (fixed winding order)
+                        // Biome tint blended at the face corners
+                        Color tints[4] = { WHITE, WHITE, WHITE, WHITE };
+                        BiomeTint tint = GetBlockTint(block, face);
+                        if (tint != TINT_NONE) {
+                            if (!padding->tintsReady) FillCornerTints(neighborhood, padding);
+                            for (int i = 0; i < 4; i++) {
+                                tints[i] = padding->cornerTints[tint][x + (int)faceVertices[face][i].x][z + (int)faceVertices[face][i].z];
+                            }
+                        }
+                        
+                        // Smooth light and AO from the cells in front of the face
+                        int occlusion[4];
+                        ShadeFace(padding, frontCell, face, tints, colors, lightLevels, *vertexIndex - 4, occlusion);
+                        
+                        // Lit lamps swap to their lit texture
+                        if ((block == BLOCK_REDSTONE_LAMP) && powered) {
+                            SetFaceTextureIndex(texCoords, *vertexIndex - 4, blockTextures.lampOn);
+                        }
+                        
+                        // Connected textures pick the tile matching the neighbors in the face plane
+                        if (ctmFirstTile[block] >= 0) {
+                            int mask = GetConnectionMask(padding, cell, frontCell - cell, face, block);
+                            SetFaceTextureIndex(texCoords, *vertexIndex - 4, ctmFirstTile[block] + ctmTiles[mask]);
+                        }
+                        
+                        // Two counter-clockwise triangles, split along the brighter diagonal (0-2 or 1-3)
                         unsigned short baseIndex = (*vertexIndex - 4);
+                        int split = (occlusion[0] + occlusion[2] >= occlusion[1] + occlusion[3])? 0 : 1;
                         
-                        // First triangle (counter-clockwise)
-                        indices[(*indexIndex)++] = baseIndex;
-                        indices[(*indexIndex)++] = baseIndex + 1;
-                        indices[(*indexIndex)++] = baseIndex + 2;
+                        indices[(*indexIndex)++] = baseIndex + split;
+                        indices[(*indexIndex)++] = baseIndex + split + 1;
+                        indices[(*indexIndex)++] = baseIndex + split + 2;
                         
-                        // Second triangle (counter-clockwise)
-                        indices[(*indexIndex)++] = baseIndex;
-                        indices[(*indexIndex)++] = baseIndex + 2;
-                        indices[(*indexIndex)++] = baseIndex + 3;
+                        indices[(*indexIndex)++] = baseIndex + split;
+                        indices[(*indexIndex)++] = baseIndex + split + 2;
+                        indices[(*indexIndex)++] = baseIndex + (split + 3) % 4;
                     }
                 }
             }
         }
     }
     
-    // Create opaque mesh
-    if (opaqueVertexIndex > 0) {
-        Mesh opaqueMesh = { 0 };
-        opaqueMesh.vertexCount = opaqueVertexIndex;
-        opaqueMesh.triangleCount = opaqueIndexIndex / 3;
-        
-        // Allocate and copy vertex data
-        opaqueMesh.vertices = (float*)RL_MALLOC(opaqueVertexIndex * 3 * sizeof(float));
-        opaqueMesh.texcoords = (float*)RL_MALLOC(opaqueVertexIndex * 2 * sizeof(float));
-        opaqueMesh.indices = (unsigned short*)RL_MALLOC(opaqueIndexIndex * sizeof(unsigned short));
-        
-        memcpy(opaqueMesh.vertices, opaqueVertices, opaqueVertexIndex * 3 * sizeof(float));
-        memcpy(opaqueMesh.texcoords, opaqueTexCoords, opaqueVertexIndex * 2 * sizeof(float));
-        memcpy(opaqueMesh.indices, opaqueIndices, opaqueIndexIndex * sizeof(unsigned short));
-        
-        // Upload mesh to GPU
-        UploadMesh(&opaqueMesh, false);
-        
-        chunk->mesh = opaqueMesh;
-        chunk->vertexCount = opaqueVertexIndex;
-        chunk->triangleCount = opaqueIndexIndex / 3;
-    }
-    
-    // Create transparent mesh
-    if (transparentVertexIndex > 0) {
-        Mesh transparentMesh = { 0 };
-        transparentMesh.vertexCount = transparentVertexIndex;
-        transparentMesh.triangleCount = transparentIndexIndex / 3;
-        
-        // Allocate and copy vertex data
-        transparentMesh.vertices = (float*)RL_MALLOC(transparentVertexIndex * 3 * sizeof(float));
-        transparentMesh.texcoords = (float*)RL_MALLOC(transparentVertexIndex * 2 * sizeof(float));
-        transparentMesh.indices = (unsigned short*)RL_MALLOC(transparentIndexIndex * sizeof(unsigned short));
-        
-        memcpy(transparentMesh.vertices, transparentVertices, transparentVertexIndex * 3 * sizeof(float));
-        memcpy(transparentMesh.texcoords, transparentTexCoords, transparentVertexIndex * 2 * sizeof(float));
-        memcpy(transparentMesh.indices, transparentIndices, transparentIndexIndex * sizeof(unsigned short));
-        
-        // Upload mesh to GPU
-        UploadMesh(&transparentMesh, false);
-        
-        chunk->transparentMesh = transparentMesh;
-        chunk->transparentVertexCount = transparentVertexIndex;
-        chunk->transparentTriangleCount = transparentIndexIndex / 3;
-    }
+    if (cancelled) opaqueVertexIndex = transparentVertexIndex = liquidVertexIndex = 0;
     
-    // Assign global materials to the chunk
     if (opaqueVertexIndex > 0) {
-        chunk->material = globalOpaqueMaterial;
+        CopyMeshData(opaqueMesh, opaqueVertices, opaqueTexCoords, opaqueColors, opaqueLight, opaqueIndices,
+                     opaqueVertexIndex, opaqueIndexIndex);
     }
-    
     if (transparentVertexIndex > 0) {
-        chunk->transparentMaterial = globalTransparentMaterial;
+        CopyMeshData(transparentMesh, transparentVertices, transparentTexCoords, transparentColors, transparentLight,
+                     transparentIndices, transparentVertexIndex, transparentIndexIndex);
     }
-    
-    // Set hasMesh flag only if we actually created something
-    if (opaqueVertexIndex > 0 || transparentVertexIndex > 0) {
-        chunk->hasMesh = true;
+    if (liquidVertexIndex > 0) {
+        CopyMeshData(liquidMesh, liquidVertices, liquidTexCoords, liquidColors, liquidLight, liquidIndices,
+                     liquidVertexIndex, liquidIndexIndex);
     }
     
     // Free temporary arrays
+    free(padding);
     free(opaqueVertices);
     free(opaqueTexCoords);
+    free(opaqueColors);
+    free(opaqueLight);
     free(opaqueIndices);
     free(transparentVertices);
     free(transparentTexCoords);
+    free(transparentColors);
+    free(transparentLight);
     free(transparentIndices);
+    free(liquidVertices);
+    free(liquidTexCoords);
+    free(liquidColors);
+    free(liquidLight);
+    free(liquidIndices);
+    
+    return !cancelled;
 }
 
 void AddFaceToMesh(Vector3 position, int faceIndex, BlockType block, 
                    float* vertices, float* texCoords, int* vertexIndex) {
     // Get texture UV coordinates for this block and face
-    float u, v, w, h;
-    GetBlockTextureUV(block, faceIndex, &u, &v, &w, &h);
+    int textureIndex = GetBlockTextureIndex(block, faceIndex);
+    float u = meshTexCoords[textureIndex][0];
+    float v = meshTexCoords[textureIndex][1];
+    float w = meshTexCoords[textureIndex][2];
+    float h = meshTexCoords[textureIndex][3];
     
     // Add vertices for this face
     for (int i = 0; i < 4; i++) {
@@ -395,13 +1710,52 @@ void AddFaceToMesh(Vector3 position, int faceIndex, BlockType block,
     }
 }
 
-bool ShouldRenderFace(VoxelWorld* world, BlockPos position, int faceIndex) {
-    BlockType neighborBlock = GetBlock(world, position);
+void AddCrossToMesh(Vector3 position, int textureIndex, float* vertices, float* texCoords,
+                    unsigned short* indices, int* vertexIndex, int* indexIndex) {
+    AddQuadsToMesh(position, crossVertices, 4, textureIndex, vertices, texCoords, indices, vertexIndex, indexIndex);
+}
+
+bool ShouldRenderFace(const ChunkNeighborhood* neighborhood, int x, int y, int z) {
+    BlockType neighborBlock = GetNeighborhoodBlock(neighborhood, x, y, z);
     
     // Render face if neighbor is air or transparent
     return IsBlockTransparent(neighborBlock);
 }
 
+//----------------------------------------------------------------------------------
+// Mesher Benchmark
+//----------------------------------------------------------------------------------
+double RunMesherBenchmark(VoxelWorld* world) {
+    int sectionCount = 0;
+    int vertexCount = 0;
+    double startTime = GetTime();
+    
+    for (int i = 0; i < MAX_CHUNKS; i++) {
+        Chunk* chunk = &world->chunks[i];
+        if (!chunk->isLoaded || (AtomicLoad(&chunk->genState) != CHUNK_GEN_READY)) continue;
+        
+        ChunkNeighborhood neighborhood;
+        AcquireChunkNeighborhood(world, chunk, &neighborhood);
+        for (int section = 0; section < CHUNK_SECTIONS; section++) {
+            Mesh opaqueMesh, transparentMesh, liquidMesh;
+            BuildChunkMesh(&neighborhood, section, &opaqueMesh, &transparentMesh, &liquidMesh, NULL);
+            vertexCount += opaqueMesh.vertexCount + transparentMesh.vertexCount + liquidMesh.vertexCount;
+            FreeMeshData(&opaqueMesh);
+            FreeMeshData(&transparentMesh);
+            FreeMeshData(&liquidMesh);
+            sectionCount++;
+        }
+        ReleaseChunkNeighborhood(&neighborhood);
+    }
+    
+    double elapsed = GetTime() - startTime;
+    double sectionTime = (sectionCount > 0)? elapsed*1000.0/sectionCount : 0.0;
+    
+    printf("Mesher benchmark: %d sections (%d vertices) in %.2f ms (%.3f ms per section)\n",
+           sectionCount, vertexCount, elapsed*1000.0, sectionTime);
+    return sectionTime;
+}
+
 //----------------------------------------------------------------------------------
 // Culling and Optimization Functions
 //----------------------------------------------------------------------------------
@@ -424,29 +1778,6 @@ void FrustumCullChunks(VoxelWorld* world, Camera3D camera) {
     }
 }
 
-void SortChunksByDistance(VoxelWorld* world, Vector3 playerPosition) {
-    // Simple bubble sort by distance (can be optimized)
-    for (int i = 0; i < MAX_CHUNKS - 1; i++) {
-        for (int j = 0; j < MAX_CHUNKS - i - 1; j++) {
-            if (!world->chunks[j].isLoaded) continue;
-            if (!world->chunks[j + 1].isLoaded) continue;
-            
-            Vector3 pos1 = ChunkToWorld(world->chunks[j].position);
-            Vector3 pos2 = ChunkToWorld(world->chunks[j + 1].position);
-            
-            float dist1 = Distance2D(playerPosition, pos1);
-            float dist2 = Distance2D(playerPosition, pos2);
-            
-            if (dist1 > dist2) {
-                // Swap chunks
-                Chunk temp = world->chunks[j];
-                world->chunks[j] = world->chunks[j + 1];
-                world->chunks[j + 1] = temp;
-            }
-        }
-    }
-}
-
 //----------------------------------------------------------------------------------
 // Texture Management Functions
 //----------------------------------------------------------------------------------
@@ -455,134 +1786,507 @@ void InitTextureManager(void) {
     textureManager.atlas = (Texture2D){0};
     memset(textureManager.texCoords, 0, sizeof(textureManager.texCoords));
     memset(textureManager.textureNames, 0, sizeof(textureManager.textureNames));
+    for (int i = 0; i < BLOCK_COUNT; i++) ctmFirstTile[i] = -1;
 }
 
-void LoadBlockTextures(void) {
-    // Load actual texture files from resources directory
-    const char* textureNames[] = {
-        "grass_block_top", "grass_block_side", "dirt",
-        "stone", "cobblestone", "bedrock", "sand", "gravel",
-        "oak_log", "oak_log_top", "oak_planks", "oak_leaves",
-        "birch_log", "birch_log_top", "birch_planks", "birch_leaves",
-        "acacia_log", "acacia_log_top", "acacia_planks", "acacia_leaves",
-        "dark_oak_log", "dark_oak_log_top", "dark_oak_planks", "dark_oak_leaves",
-        "stone_bricks", "mossy_stone_bricks", "andesite", "granite", "diorite",
-        "sandstone", "sandstone_top", "sandstone_bottom",
-        "coal_ore", "iron_ore", "gold_ore", "diamond_ore",
-        "iron_block", "gold_block", "diamond_block",
-        "white_wool", "orange_wool", "blue_wool", "red_wool",
-        "glass", "bricks", "bookshelf", "glowstone", "obsidian",
-        "netherrack", "end_stone", "quartz_block", "packed_ice"
-    };
-    
-    int textureCount = sizeof(textureNames) / sizeof(textureNames[0]);
+// Copy a 16x16 texture into the next free atlas slot, returns its texture index (-1 if the atlas is full)
+static int AddAtlasTexture(TextureManager* manager, Image* atlasImage, Image* texture, const char* name) {
+    int index = manager->textureCount;
+    if (index >= MAX_BLOCK_TEXTURES) return -1;
+    
+    // Ensure texture has an alpha channel and the correct size
+    if (texture->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ImageFormat(texture, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    if (texture->width != TEXTURE_SIZE || texture->height != TEXTURE_SIZE) ImageResize(texture, TEXTURE_SIZE, TEXTURE_SIZE);
+    
+    // Calculate position in atlas
     int texturesPerRow = TEXTURE_ATLAS_SIZE / TEXTURE_SIZE;
+    int x = (index % texturesPerRow) * TEXTURE_SIZE;
+    int y = (index / texturesPerRow) * TEXTURE_SIZE;
     
-    // Create atlas image with transparent background (RGBA with alpha = 0)
-    Image atlasImage = GenImageColor(TEXTURE_ATLAS_SIZE, TEXTURE_ATLAS_SIZE, (Color){0, 0, 0, 0});
+    // Copy texture to atlas preserving alpha channel (use BLANK instead of WHITE)
+    ImageDraw(atlasImage, *texture, 
+              (Rectangle){0, 0, TEXTURE_SIZE, TEXTURE_SIZE}, 
+              (Rectangle){x, y, TEXTURE_SIZE, TEXTURE_SIZE}, 
+              (Color){255, 255, 255, 255}); // Use full white with full alpha
     
-    int successfulLoads = 0;
-    int placeholderCount = 0;
-    
-    for (int i = 0; i < textureCount && i < MAX_BLOCK_TEXTURES; i++) {
-        // Try multiple potential file paths
-        char filePath[256];
-        Image blockTexture = {0};
-        bool loaded = false;
-        
-        // Try different possible paths
-        const char* possiblePaths[] = {
-            "src/resources/textures/block/%s.png",
-            "resources/textures/block/%s.png", 
-            "./src/resources/textures/block/%s.png",
-            "./resources/textures/block/%s.png"
-        };
-        
-        for (int pathIdx = 0; pathIdx < 4; pathIdx++) {
-            snprintf(filePath, sizeof(filePath), possiblePaths[pathIdx], textureNames[i]);
-            
-            if (FileExists(filePath)) {
-                blockTexture = LoadImage(filePath);
-                if (blockTexture.data != NULL) {
-                    loaded = true;
-                    successfulLoads++;
-                    
-                    // Ensure image format supports alpha channel
-                    if (blockTexture.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
-                        ImageFormat(&blockTexture, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
-                    }
-                    break;
-                }
-            }
+    // Store texture info
+    snprintf(manager->textureNames[index], sizeof(manager->textureNames[index]), "%s", name);
+    manager->texCoords[index][0] = (float)x / TEXTURE_ATLAS_SIZE;  // u
+    manager->texCoords[index][1] = (float)y / TEXTURE_ATLAS_SIZE;  // v
+    manager->texCoords[index][2] = (float)TEXTURE_SIZE / TEXTURE_ATLAS_SIZE;  // width
+    manager->texCoords[index][3] = (float)TEXTURE_SIZE / TEXTURE_ATLAS_SIZE;  // height
+    
+    manager->textureCount++;
+    return index;
+}
+
+// Resolve every atlas input in atlas order: block textures, the tile set of every connected texture block, then
+// the animation strips (last, their frame count is only known once decoded)
+// NOTE: Runs on the calling thread, TextFormat() buffers are not safe to share with the decode jobs
+static int CollectAtlasSources(AtlasSource* sources, int* firstTiles, int* connectedSets) {
+    int textureCount = sizeof(blockTextureNames) / sizeof(blockTextureNames[0]);
+    int colorCount = sizeof(placeholderColors) / sizeof(placeholderColors[0]);
+    int count = 0;
+    
+    for (int i = 0; i < textureCount && count < MAX_BLOCK_TEXTURES; i++) {
+        AtlasSource* source = &sources[count++];
+        if (!FindResourcePath(TextFormat("textures/block/%s.png", blockTextureNames[i]), source->path, sizeof(source->path))) {
+            source->path[0] = '\0';
         }
+        snprintf(source->name, sizeof(source->name), "%s", blockTextureNames[i]);
+        source->fallback = (i < colorCount)? placeholderColors[i] : WHITE;
+        source->frameCount = 1;
+    }
+    
+    // Generated, never on disk (see InitBlockTextureTable)
+    if (count < MAX_BLOCK_TEXTURES) {
+        AtlasSource* source = &sources[count++];
+        source->path[0] = '\0';
+        snprintf(source->name, sizeof(source->name), "%s", MISSING_TEXTURE);
+        source->fallback = MAGENTA;
+        source->frameCount = 1;
+    }
+    
+    // A connected texture set missing any tile is skipped, its slots are reused by the next set
+    *connectedSets = 0;
+    for (int block = 0; block < BLOCK_COUNT; block++) {
+        firstTiles[block] = -1;
+        const char* set = GetConnectedTextureSet((BlockType)block);
+        if (set == NULL) continue;
         
-        if (!loaded) {
-            // Create a placeholder colored texture with full alpha
-            Color placeholderColors[] = {
-                GREEN, DARKGREEN, BROWN, GRAY, DARKGRAY, (Color){64,64,64,255}, 
-                BEIGE, (Color){136,136,136,255}, (Color){139,69,19,255}, (Color){162,130,78,255},
-                DARKGREEN, (Color){220,220,220,255}, (Color){192,175,121,255}, (Color){128,167,85,255},
-                (Color){186,99,64,255}, (Color){168,90,50,255}, (Color){99,128,15,255}, (Color){66,43,20,255},
-                (Color){123,123,123,255}, (Color){115,121,105,255}, (Color){132,134,132,255}, (Color){149,103,85,255},
-                (Color){188,188,188,255}, (Color){245,238,173,255}, (Color){84,84,84,255}, (Color){135,106,97,255},
-                (Color){143,140,125,255}, (Color){92,219,213,255}, (Color){220,220,220,255}, GOLD,
-                (Color){93,219,213,255}, WHITE, ORANGE, BLUE, RED, (Color){255,255,255,128},
-                (Color){150,97,83,255}, (Color){139,69,19,255}, (Color){255,207,139,255}, (Color){20,18,30,255},
-                (Color){97,38,38,255}, (Color){221,223,165,255}, (Color){235,229,222,255}, (Color){160,160,255,255}
-            };
-            
-            Color color = (i < sizeof(placeholderColors) / sizeof(placeholderColors[0])) ? 
-                          placeholderColors[i] : WHITE;
-            blockTexture = GenImageColor(TEXTURE_SIZE, TEXTURE_SIZE, color);
-            
-            // Ensure placeholder also has alpha channel
-            ImageFormat(&blockTexture, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
-            placeholderCount++;
+        bool complete = (count + CTM_TILE_COUNT <= MAX_BLOCK_TEXTURES);
+        for (int tile = 0; (tile < CTM_TILE_COUNT) && complete; tile++) {
+            AtlasSource* source = &sources[count + tile];
+            complete = FindResourcePath(TextFormat("optifine/ctm/%s/%i.png", set, tile), source->path, sizeof(source->path));
+            snprintf(source->name, sizeof(source->name), "ctm/%s/%i", set, tile);
+            source->fallback = (Color){255, 255, 255, 128};
+            source->frameCount = 1;
         }
+        if (!complete) continue;
         
-        // Ensure texture is the correct size
-        if (blockTexture.width != TEXTURE_SIZE || blockTexture.height != TEXTURE_SIZE) {
-            ImageResize(&blockTexture, TEXTURE_SIZE, TEXTURE_SIZE);
+        firstTiles[block] = count;
+        count += CTM_TILE_COUNT;
+        (*connectedSets)++;
+    }
+    
+    int animationCount = sizeof(animatedTextures) / sizeof(animatedTextures[0]);
+    for (int i = 0; i < animationCount && count < MAX_BLOCK_TEXTURES; i++) {
+        AtlasSource* source = &sources[count++];
+        if (!FindResourcePath(TextFormat("textures/block/%s.png", animatedTextures[i].name), source->path, sizeof(source->path))) {
+            source->path[0] = '\0';
         }
+        snprintf(source->name, sizeof(source->name), "%s", animatedTextures[i].name);
+        source->fallback = animatedTextures[i].fallback;
+        source->frameCount = 1;
+        source->animated = true;
+    }
+    
+    return count;
+}
+
+// Cut an animation strip into its square frames, each scaled to TEXTURE_SIZE, stacked in a new strip
+static void ScaleAnimationFrames(AtlasSource* source) {
+    Image strip = source->image;
+    int frameCount = strip.height/strip.width;
+    int frameHeight = strip.height/frameCount;
+    int frameBytes = TEXTURE_SIZE*TEXTURE_SIZE*4;
+    
+    Image frames = GenImageColor(TEXTURE_SIZE, TEXTURE_SIZE*frameCount, (Color){0, 0, 0, 0});
+    for (int frame = 0; frame < frameCount; frame++) {
+        Image frameImage = ImageFromImage(strip, (Rectangle){ 0, (float)(frame*frameHeight), (float)strip.width, (float)frameHeight });
+        ImageResize(&frameImage, TEXTURE_SIZE, TEXTURE_SIZE);
+        memcpy((unsigned char*)frames.data + frame*frameBytes, frameImage.data, frameBytes);
+        UnloadImage(frameImage);
+    }
+    
+    UnloadImage(strip);
+    source->image = frames;
+    source->frameCount = frameCount;
+}
+
+// Decode and convert a batch of atlas inputs to TEXTURE_SIZE RGBA, any thread
+static void DecodeAtlasSourcesJob(void* userData) {
+    AtlasDecodeBatch* batch = (AtlasDecodeBatch*)userData;
+    
+    for (int i = batch->start; i < batch->end; i++) {
+        AtlasSource* source = &batch->sources[i];
+        source->image = (source->path[0] != '\0')? LoadImage(source->path) : (Image){0};
+        source->decoded = (source->image.data != NULL);
+        if (!source->decoded) source->image = GenImageColor(TEXTURE_SIZE, TEXTURE_SIZE, source->fallback);
         
-        // Calculate position in atlas
-        int x = (i % texturesPerRow) * TEXTURE_SIZE;
-        int y = (i / texturesPerRow) * TEXTURE_SIZE;
-        
-        // Copy texture to atlas preserving alpha channel (use BLANK instead of WHITE)
-        ImageDraw(&atlasImage, blockTexture, 
-                  (Rectangle){0, 0, TEXTURE_SIZE, TEXTURE_SIZE}, 
-                  (Rectangle){x, y, TEXTURE_SIZE, TEXTURE_SIZE}, 
-                  (Color){255, 255, 255, 255}); // Use full white with full alpha
+        if (source->image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ImageFormat(&source->image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        if (source->animated && source->decoded && (source->image.height >= 2*source->image.width)) {
+            ScaleAnimationFrames(source);
+        } else if (source->image.width != TEXTURE_SIZE || source->image.height != TEXTURE_SIZE) {
+            ImageResize(&source->image, TEXTURE_SIZE, TEXTURE_SIZE);
+        }
+    }
+}
+
+// Decode every block texture and connected texture tile into a new atlas image
+// NOTE: Files are decoded on the job workers, only the blit into the atlas runs here, in atlas order
+static Image ComposeBlockAtlas(TextureManager* manager, int* firstTiles) {
+    AtlasSource* sources = (AtlasSource*)RL_CALLOC(MAX_BLOCK_TEXTURES, sizeof(AtlasSource));
+    int connectedSets = 0;
+    int sourceCount = CollectAtlasSources(sources, firstTiles, &connectedSets);
+    
+    AtlasDecodeBatch batches[MAX_BLOCK_TEXTURES/ATLAS_DECODE_BATCH];
+    JobDecl jobs[MAX_BLOCK_TEXTURES/ATLAS_DECODE_BATCH];
+    JobCounter counter = { 0 };
+    int batchCount = 0;
+    
+    for (int start = 0; start < sourceCount; start += ATLAS_DECODE_BATCH) {
+        int end = (start + ATLAS_DECODE_BATCH < sourceCount)? start + ATLAS_DECODE_BATCH : sourceCount;
+        batches[batchCount] = (AtlasDecodeBatch){ sources, start, end };
+        jobs[batchCount] = (JobDecl){ DecodeAtlasSourcesJob, &batches[batchCount] };
+        batchCount++;
+    }
+    
+    double startTime = GetTime();
+    if (batchCount > 0) RunJobs(jobs, batchCount, &counter);
+    WaitForCounter(&counter);
+    double decodeTime = (GetTime() - startTime)*1000.0;
+    
+    // Create atlas image with transparent background (RGBA with alpha = 0)
+    Image atlasImage = GenImageColor(TEXTURE_ATLAS_SIZE, TEXTURE_ATLAS_SIZE, (Color){0, 0, 0, 0});
+    
+    int successfulLoads = 0;
+    for (int i = 0; i < sourceCount; i++) {
+        AtlasSource* source = &sources[i];
+        for (int frame = 0; frame < source->frameCount; frame++) {
+            Image frameImage = ImageFromImage(source->image, (Rectangle){ 0, (float)(frame*TEXTURE_SIZE), TEXTURE_SIZE, TEXTURE_SIZE });
+            AddAtlasTexture(manager, &atlasImage, &frameImage, (frame == 0)? source->name : TextFormat("%s/%i", source->name, frame));
+            UnloadImage(frameImage);
+        }
+        if (source->decoded) successfulLoads++;
+        UnloadImage(source->image);
+    }
+    RL_FREE(sources);
+    
+    printf("Block textures decoded: %d successful, %d placeholders, %d connected texture sets (%d jobs, %.2f ms decoding)\n",
+           successfulLoads, sourceCount - successfulLoads, connectedSets, batchCount, decodeTime);
+    return atlasImage;
+}
+
+// FNV-1a over bytes, chained through hash
+static unsigned long long HashBytes(unsigned long long hash, const void* data, int size) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (int i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Hash one atlas input: where it resolves and when it was last modified (missing files hash their name)
+static unsigned long long HashAtlasInput(unsigned long long hash, const char* relativePath) {
+    char path[256];
+    if (FindResourcePath(relativePath, path, sizeof(path))) {
+        long modTime = GetFileModTime(path);
+        hash = HashBytes(hash, path, (int)strlen(path));
+        hash = HashBytes(hash, &modTime, sizeof(modTime));
+    } else {
+        hash = HashBytes(hash, relativePath, (int)strlen(relativePath));
+    }
+    return hash;
+}
+
+// Cache key: file list, resolved paths and modification times of every atlas input, plus the layout
+static unsigned long long HashAtlasInputs(void) {
+    const int layout[4] = { ATLAS_CACHE_VERSION, TEXTURE_ATLAS_SIZE, TEXTURE_SIZE, BLOCK_COUNT };
+    unsigned long long hash = HashBytes(14695981039346656037ULL, layout, sizeof(layout));
+    
+    int textureCount = sizeof(blockTextureNames) / sizeof(blockTextureNames[0]);
+    for (int i = 0; i < textureCount; i++) {
+        hash = HashAtlasInput(hash, TextFormat("textures/block/%s.png", blockTextureNames[i]));
+    }
+    
+    for (int block = 0; block < BLOCK_COUNT; block++) {
+        const char* set = GetConnectedTextureSet((BlockType)block);
+        if (set == NULL) continue;
         
-        // Store texture info
-        strcpy(textureManager.textureNames[i], textureNames[i]);
-        textureManager.texCoords[i][0] = (float)x / TEXTURE_ATLAS_SIZE;  // u
-        textureManager.texCoords[i][1] = (float)y / TEXTURE_ATLAS_SIZE;  // v
-        textureManager.texCoords[i][2] = (float)TEXTURE_SIZE / TEXTURE_ATLAS_SIZE;  // width
-        textureManager.texCoords[i][3] = (float)TEXTURE_SIZE / TEXTURE_ATLAS_SIZE;  // height
+        for (int tile = 0; tile < CTM_TILE_COUNT; tile++) {
+            hash = HashAtlasInput(hash, TextFormat("optifine/ctm/%s/%i.png", set, tile));
+        }
+    }
+    
+    int animationCount = sizeof(animatedTextures) / sizeof(animatedTextures[0]);
+    for (int i = 0; i < animationCount; i++) {
+        hash = HashAtlasInput(hash, TextFormat("textures/block/%s.png", animatedTextures[i].name));
+    }
+    
+    return hash;
+}
+
+// Read the atlas back from the cache, false if it is missing, stale or damaged
+// NOTE: The file is read whole into one buffer, the pixels come first so that buffer becomes the image data
+static bool LoadAtlasCache(const char* fileName, unsigned long long key, TextureManager* manager, int* firstTiles, Image* image) {
+    FILE* file = fopen(fileName, "rb");
+    if (!file) return false;
+    
+    // Footer first, a stale cache is rejected without reading the pixels
+    AtlasCacheFooter footer = { 0 };
+    bool valid = (fseek(file, -(long)sizeof(footer), SEEK_END) == 0) && (fread(&footer, sizeof(footer), 1, file) == 1);
+    valid = valid && (footer.magic == ATLAS_CACHE_MAGIC) && (footer.version == ATLAS_CACHE_VERSION) && (footer.key == key) &&
+            (footer.atlasSize == TEXTURE_ATLAS_SIZE) && (footer.textureSize == TEXTURE_SIZE) && (footer.blockCount == BLOCK_COUNT) &&
+            (footer.textureCount >= 0) && (footer.textureCount <= MAX_BLOCK_TEXTURES);
+    
+    long pixelBytes = (long)TEXTURE_ATLAS_SIZE*TEXTURE_ATLAS_SIZE*4;
+    long fileSize = valid? ftell(file) : 0;
+    valid = valid && (fileSize == pixelBytes + (long)(BLOCK_COUNT*sizeof(int) + footer.textureCount*(sizeof(manager->texCoords[0]) +
+                                                      sizeof(manager->textureNames[0])) + sizeof(footer)));
+    
+    unsigned char* data = NULL;
+    if (valid) {
+        data = (unsigned char*)RL_MALLOC(fileSize);
+        rewind(file);
+        valid = (fread(data, fileSize, 1, file) == 1);
+    }
+    fclose(file);
+    
+    if (!valid) {
+        RL_FREE(data);
+        return false;
+    }
+    
+    // Tables follow the pixels
+    const unsigned char* tables = data + pixelBytes;
+    memcpy(firstTiles, tables, BLOCK_COUNT*sizeof(int));
+    tables += BLOCK_COUNT*sizeof(int);
+    memcpy(manager->texCoords, tables, footer.textureCount*sizeof(manager->texCoords[0]));
+    tables += footer.textureCount*sizeof(manager->texCoords[0]);
+    memcpy(manager->textureNames, tables, footer.textureCount*sizeof(manager->textureNames[0]));
+    manager->textureCount = footer.textureCount;
+    
+    *image = (Image){ .data = data, .width = TEXTURE_ATLAS_SIZE, .height = TEXTURE_ATLAS_SIZE, .mipmaps = 1,
+                      .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    return true;
+}
+
+// Write pixels, tables and footer; the footer goes last so a torn write never validates
+static void SaveAtlasCache(const char* fileName, unsigned long long key, const TextureManager* manager, const int* firstTiles, Image image) {
+    FILE* file = fopen(fileName, "wb");
+    if (!file) {
+        printf("Warning: Cannot write texture atlas cache: %s\n", fileName);
+        return;
+    }
+    
+    AtlasCacheFooter footer = { ATLAS_CACHE_MAGIC, ATLAS_CACHE_VERSION, key, TEXTURE_ATLAS_SIZE, TEXTURE_SIZE, BLOCK_COUNT,
+                                manager->textureCount };
+    int count = manager->textureCount;
+    bool written = (fwrite(image.data, (size_t)TEXTURE_ATLAS_SIZE*TEXTURE_ATLAS_SIZE*4, 1, file) == 1) &&
+                   (fwrite(firstTiles, sizeof(int), BLOCK_COUNT, file) == BLOCK_COUNT) &&
+                   (fwrite(manager->texCoords, sizeof(manager->texCoords[0]), count, file) == (size_t)count) &&
+                   (fwrite(manager->textureNames, sizeof(manager->textureNames[0]), count, file) == (size_t)count) &&
+                   (fwrite(&footer, sizeof(footer), 1, file) == 1);
+    fclose(file);
+    
+    if (!written) remove(fileName);
+}
+
+// Atlas image and tables from the cache when the inputs are unchanged, else decoded and cached again
+static Image BuildBlockAtlas(TextureManager* manager, int* firstTiles, bool useCache, bool* fromCache) {
+    unsigned long long key = HashAtlasInputs();
+    
+    Image atlasImage = { 0 };
+    *fromCache = useCache && LoadAtlasCache(ATLAS_CACHE_FILE, key, manager, firstTiles, &atlasImage);
+    if (!*fromCache) {
+        manager->textureCount = 0;
+        atlasImage = ComposeBlockAtlas(manager, firstTiles);
+        SaveAtlasCache(ATLAS_CACHE_FILE, key, manager, firstTiles, atlasImage);
+    }
+    
+    return atlasImage;
+}
+
+// Find the frames of every animated texture by name, the same after a cache load as after a decode
+static void InitTextureAnimations(void) {
+    int slotsPerRow = TEXTURE_ATLAS_SIZE/TEXTURE_SIZE;
+    memset(textureAnimationIds, 0, sizeof(textureAnimationIds));
+    for (int i = 0; i < MAX_TEXTURE_ANIMATIONS; i++) {
+        textureAnimations[i][0] = 0.0f;
+        textureAnimations[i][1] = 1.0f;
+        textureAnimations[i][2] = 1.0f;
+        textureAnimations[i][3] = (float)slotsPerRow;
+    }
+    
+    int animationCount = sizeof(animatedTextures) / sizeof(animatedTextures[0]);
+    for (int i = 0; (i < animationCount) && (i + 1 < MAX_TEXTURE_ANIMATIONS); i++) {
+        const char* name = animatedTextures[i].name;
+        int first = GetTextureIndex(name);
+        if (first < 0) continue;
         
-        textureManager.textureCount++;
+        int frameCount = 1;
+        while ((first + frameCount < textureManager.textureCount) &&
+               (strcmp(textureManager.textureNames[first + frameCount], TextFormat("%s/%i", name, frameCount)) == 0)) frameCount++;
         
-        // Clean up individual texture
-        UnloadImage(blockTexture);
+        textureAnimationIds[first] = (unsigned char)(i + 1);
+        textureAnimations[i + 1][0] = (float)first;
+        textureAnimations[i + 1][1] = (float)frameCount;
+        textureAnimations[i + 1][2] = (float)animatedTextures[i].frameTicks;
+    }
+}
+
+// Atlas index of a texture named by the block table, a name the atlas lacks is reported and drawn as MISSING_TEXTURE
+static short ResolveBlockTexture(const char* textureName, int missingIndex) {
+    int index = GetTextureIndex(textureName);
+    if (index < 0) {
+        printf("Error: Block texture '%s' is not in the atlas\n", textureName);
+        return (short)missingIndex;
+    }
+    return (short)index;
+}
+
+// Resolve every block face and state texture by name once, the mesher then only indexes the table
+static void InitBlockTextureTable(void) {
+    int missingIndex = GetTextureIndex(MISSING_TEXTURE);
+    if (missingIndex < 0) missingIndex = 0;
+    
+    for (int block = 0; block < BLOCK_COUNT; block++) {
+        for (int face = 0; face < 6; face++) {
+            blockTextures.faces[block][face] = ResolveBlockTexture(GetBlockTextureName((BlockType)block, face), missingIndex);
+        }
+    }
+    for (int stage = 0; stage <= WHEAT_MAX_STAGE; stage++) {
+        blockTextures.wheatStages[stage] = ResolveBlockTexture(wheatStageTextures[stage], missingIndex);
+    }
+    blockTextures.lampOn = ResolveBlockTexture("redstone_lamp_on", missingIndex);
+    blockTextures.torchOff = ResolveBlockTexture("redstone_torch_off", missingIndex);
+    blockTextures.wirePowered = ResolveBlockTexture("redstone_block", missingIndex);
+}
+
+#if defined(BLOCK_TEXTURE_ARRAY)
+// Copy every atlas slot into its own layer and build the full mip chain of each, 0 if the context cannot hold them
+// NOTE: Layers never sample their neighbors, so mipmapping and tiling do not bleed as in the atlas
+static unsigned int LoadBlockTextureArray(Image atlasImage, int layerCount) {
+    int version = rlGetVersion();
+    int maxLayers = 0;
+    if ((version == RL_OPENGL_33) || (version == RL_OPENGL_43)) glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayers);
+    if ((layerCount == 0) || (layerCount > maxLayers)) {
+        printf("Voxel renderer: texture array unavailable (%d layers, %d supported), using the atlas\n", layerCount, maxLayers);
+        return 0;
+    }
+    
+    int texturesPerRow = TEXTURE_ATLAS_SIZE/TEXTURE_SIZE;
+    int rowBytes = TEXTURE_SIZE*4;
+    const unsigned char* atlas = (const unsigned char*)atlasImage.data;
+    unsigned char* layers = (unsigned char*)RL_MALLOC((size_t)layerCount*TEXTURE_SIZE*rowBytes);
+    for (int layer = 0; layer < layerCount; layer++) {
+        int x = (layer % texturesPerRow)*TEXTURE_SIZE;
+        int y = (layer / texturesPerRow)*TEXTURE_SIZE;
+        for (int row = 0; row < TEXTURE_SIZE; row++) {
+            memcpy(&layers[(layer*TEXTURE_SIZE + row)*rowBytes], &atlas[((y + row)*TEXTURE_ATLAS_SIZE + x)*4], rowBytes);
+        }
     }
     
-    // Create texture from atlas
+    unsigned int id = 0;
+    glGenTextures(1, &id);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, id);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, TEXTURE_SIZE, TEXTURE_SIZE, layerCount, 0, GL_RGBA, GL_UNSIGNED_BYTE, layers);
+    glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+    
+    // Pixelated up close and blended between mips at range, layers repeat for tiled quads
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    RL_FREE(layers);
+    
+    return id;
+}
+#endif
+
+static void UnloadBlockTextureArray(void) {
+#if defined(BLOCK_TEXTURE_ARRAY)
+    if (blockTextureArray != 0) glDeleteTextures(1, &blockTextureArray);
+#endif
+    blockTextureArray = 0;
+}
+
+void LoadBlockTextures(void) {
+    double startTime = GetTime();
+    bool fromCache = false;
+    Image atlasImage = BuildBlockAtlas(&textureManager, ctmFirstTile, true, &fromCache);
+    InitTextureAnimations();
+    InitBlockTextureTable();
+    
+    // Create texture from atlas, UI icons and particles keep using it on the texture array path
     textureManager.atlas = LoadTextureFromImage(atlasImage);
+    UnloadBlockTextureArray();
+#if defined(BLOCK_TEXTURE_ARRAY)
+    blockTextureArray = LoadBlockTextureArray(atlasImage, textureManager.textureCount);
+#endif
     UnloadImage(atlasImage);
     
     // Set texture filter to point (pixelated) for retro look
     SetTextureFilter(textureManager.atlas, TEXTURE_FILTER_POINT);
     
-    printf("Block textures loaded: %d successful, %d placeholders\n", successfulLoads, placeholderCount);
+    printf("Block textures loaded: %d textures from %s in %.2f ms\n", textureManager.textureCount,
+           fromCache? "atlas cache" : "image files", (GetTime() - startTime)*1000.0);
+}
+
+// Cold (decode everything, rewrite the cache) against warm (read the cache) atlas build, into scratch tables
+// NOTE: The GPU upload is the same either way and is left out, the live atlas is not touched
+AtlasCacheTimes RunAtlasCacheBenchmark(void) {
+    TextureManager* scratch = (TextureManager*)RL_CALLOC(1, sizeof(TextureManager));
+    int firstTiles[BLOCK_COUNT] = { 0 };
+    AtlasCacheTimes times = { 0 };
+    bool fromCache = false;
+    
+    double startTime = GetTime();
+    Image atlasImage = BuildBlockAtlas(scratch, firstTiles, false, &fromCache);
+    times.coldTime = (GetTime() - startTime)*1000.0;
+    UnloadImage(atlasImage);
+    
+    startTime = GetTime();
+    atlasImage = BuildBlockAtlas(scratch, firstTiles, true, &fromCache);
+    times.warmTime = (GetTime() - startTime)*1000.0;
+    UnloadImage(atlasImage);
+    RL_FREE(scratch);
+    
+    printf("Atlas cache benchmark: cold %.2f ms, warm %.2f ms%s\n", times.coldTime, times.warmTime,
+           fromCache? "" : " (cache could not be read back)");
+    return times;
 }
 
 void UnloadTextureManager(void) {
     if (textureManager.atlas.id > 0) {
         UnloadTexture(textureManager.atlas);
     }
+    UnloadBlockTextureArray();
     textureManager = (TextureManager){0};
+    for (int i = 0; i < BLOCK_COUNT; i++) ctmFirstTile[i] = -1;
+}
+
+// Colormaps stay in CPU memory, the mesher samples them on job workers
+void LoadBiomeColormaps(void) {
+    int loaded = 0;
+    for (int i = 0; i < COLORMAP_COUNT; i++) {
+        BiomeColormap* colormap = &colormaps[i];
+        *colormap = (BiomeColormap){ .fallback = colormapFallbacks[i] };
+        
+        char path[256];
+        if (!FindResourcePath(colormapFiles[i], path, sizeof(path))) continue;
+        
+        Image image = LoadImage(path);
+        if (image.data != NULL) {
+            colormap->colors = LoadImageColors(image);
+            colormap->width = image.width;
+            colormap->height = image.height;
+            loaded++;
+        }
+        UnloadImage(image);
+    }
+    
+    printf("Biome colormaps loaded: %d of %d\n", loaded, COLORMAP_COUNT);
+}
+
+void UnloadBiomeColormaps(void) {
+    for (int i = 0; i < COLORMAP_COUNT; i++) {
+        if (colormaps[i].colors) UnloadImageColors(colormaps[i].colors);
+        colormaps[i] = (BiomeColormap){0};
+    }
 }
 
 int GetTextureIndex(const char* textureName) {
@@ -591,7 +2295,18 @@ int GetTextureIndex(const char* textureName) {
             return i;
         }
     }
-    return 0; // Default to first texture if not found
+    return -1;
+}
+
+// Resources are found relative to the repository root or to the executable
+bool FindResourcePath(const char* relativePath, char* path, int size) {
+    const char* possiblePaths[] = { "src/resources/%s", "resources/%s", "./src/resources/%s", "./resources/%s" };
+    
+    for (int i = 0; i < 4; i++) {
+        snprintf(path, size, possiblePaths[i], relativePath);
+        if (FileExists(path)) return true;
+    }
+    return false;
 }
 
 Texture2D GetTextureAtlas(void) {
@@ -624,175 +2339,20 @@ bool ValidateTextureManager(void) {
     return true; // Already valid
 }
 
+// Atlas rect of a block face, for UI icons and particles (chunk meshes may sample the texture array instead)
 void GetBlockTextureUV(BlockType block, int faceIndex, float* u, float* v, float* w, float* h) {
-    const char* textureName = "stone"; // Default
-    
-    // Map block types and faces to texture names
-    switch (block) {
-        case BLOCK_GRASS:
-            if (faceIndex == FACE_TOP) textureName = "grass_block_top";
-            else if (faceIndex == FACE_BOTTOM) textureName = "dirt";
-            else textureName = "grass_block_side";
-            break;
-        case BLOCK_DIRT: textureName = "dirt"; break;
-        case BLOCK_STONE: textureName = "stone"; break;
-        case BLOCK_COBBLESTONE: textureName = "cobblestone"; break;
-        case BLOCK_BEDROCK: textureName = "bedrock"; break;
-        case BLOCK_SAND: textureName = "sand"; break;
-        case BLOCK_GRAVEL: textureName = "gravel"; break;
-        case BLOCK_WATER: textureName = "water_still"; break;
-        
-        // Wood blocks
-        case BLOCK_OAK_LOG:
-            if (faceIndex == FACE_TOP || faceIndex == FACE_BOTTOM) textureName = "oak_log_top";
-            else textureName = "oak_log";
-            break;
-        case BLOCK_OAK_PLANKS: textureName = "oak_planks"; break;
-        case BLOCK_OAK_LEAVES: textureName = "oak_leaves"; break;
-        case BLOCK_BIRCH_LOG:
-            if (faceIndex == FACE_TOP || faceIndex == FACE_BOTTOM) textureName = "birch_log_top";
-            else textureName = "birch_log";
-            break;
-        case BLOCK_BIRCH_PLANKS: textureName = "birch_planks"; break;
-        case BLOCK_BIRCH_LEAVES: textureName = "birch_leaves"; break;
-        case BLOCK_ACACIA_LOG:
-            if (faceIndex == FACE_TOP || faceIndex == FACE_BOTTOM) textureName = "acacia_log_top";
-            else textureName = "acacia_log";
-            break;
-        case BLOCK_ACACIA_PLANKS: textureName = "acacia_planks"; break;
-        case BLOCK_ACACIA_LEAVES: textureName = "acacia_leaves"; break;
-        case BLOCK_DARK_OAK_LOG:
-            if (faceIndex == FACE_TOP || faceIndex == FACE_BOTTOM) textureName = "dark_oak_log_top";
-            else textureName = "dark_oak_log";
-            break;
-        case BLOCK_DARK_OAK_PLANKS: textureName = "dark_oak_planks"; break;
-        case BLOCK_DARK_OAK_LEAVES: textureName = "dark_oak_leaves"; break;
-        
-        // Stone variants
-        case BLOCK_STONE_BRICKS: textureName = "stone_bricks"; break;
-        case BLOCK_MOSSY_STONE_BRICKS: textureName = "mossy_stone_bricks"; break;
-        case BLOCK_ANDESITE: textureName = "andesite"; break;
-        case BLOCK_GRANITE: textureName = "granite"; break;
-        case BLOCK_DIORITE: textureName = "diorite"; break;
-        case BLOCK_MOSSY_COBBLESTONE: textureName = "mossy_cobblestone"; break;
-        case BLOCK_SMOOTH_STONE: textureName = "smooth_stone"; break;
-        
-        // Sandstone
-        case BLOCK_SANDSTONE:
-            if (faceIndex == FACE_TOP) textureName = "sandstone_top";
-            else if (faceIndex == FACE_BOTTOM) textureName = "sandstone_bottom";
-            else textureName = "sandstone";
-            break;
-        case BLOCK_CHISELED_SANDSTONE: textureName = "chiseled_sandstone"; break;
-        case BLOCK_CUT_SANDSTONE: textureName = "cut_sandstone"; break;
-        case BLOCK_RED_SAND: textureName = "red_sand"; break;
-        case BLOCK_RED_SANDSTONE: textureName = "red_sandstone"; break;
-        
-        // Ores
-        case BLOCK_COAL_ORE: textureName = "coal_ore"; break;
-        case BLOCK_IRON_ORE: textureName = "iron_ore"; break;
-        case BLOCK_GOLD_ORE: textureName = "gold_ore"; break;
-        case BLOCK_DIAMOND_ORE: textureName = "diamond_ore"; break;
-        case BLOCK_REDSTONE_ORE: textureName = "redstone_ore"; break;
-        case BLOCK_EMERALD_ORE: textureName = "emerald_ore"; break;
-        case BLOCK_LAPIS_ORE: textureName = "lapis_ore"; break;
-        
-        // Metal blocks
-        case BLOCK_IRON_BLOCK: textureName = "iron_block"; break;
-        case BLOCK_GOLD_BLOCK: textureName = "gold_block"; break;
-        case BLOCK_DIAMOND_BLOCK: textureName = "diamond_block"; break;
-        case BLOCK_EMERALD_BLOCK: textureName = "emerald_block"; break;
-        case BLOCK_REDSTONE_BLOCK: textureName = "redstone_block"; break;
-        case BLOCK_LAPIS_BLOCK: textureName = "lapis_block"; break;
-        case BLOCK_COAL_BLOCK: textureName = "coal_block"; break;
-        
-        // Wool blocks
-        case BLOCK_WHITE_WOOL: textureName = "white_wool"; break;
-        case BLOCK_ORANGE_WOOL: textureName = "orange_wool"; break;
-        case BLOCK_MAGENTA_WOOL: textureName = "magenta_wool"; break;
-        case BLOCK_LIGHT_BLUE_WOOL: textureName = "light_blue_wool"; break;
-        case BLOCK_YELLOW_WOOL: textureName = "yellow_wool"; break;
-        case BLOCK_LIME_WOOL: textureName = "lime_wool"; break;
-        case BLOCK_PINK_WOOL: textureName = "pink_wool"; break;
-        case BLOCK_GRAY_WOOL: textureName = "gray_wool"; break;
-        case BLOCK_LIGHT_GRAY_WOOL: textureName = "light_gray_wool"; break;
-        case BLOCK_CYAN_WOOL: textureName = "cyan_wool"; break;
-        case BLOCK_PURPLE_WOOL: textureName = "purple_wool"; break;
-        case BLOCK_BLUE_WOOL: textureName = "blue_wool"; break;
-        case BLOCK_BROWN_WOOL: textureName = "brown_wool"; break;
-        case BLOCK_GREEN_WOOL: textureName = "green_wool"; break;
-        case BLOCK_RED_WOOL: textureName = "red_wool"; break;
-        case BLOCK_BLACK_WOOL: textureName = "black_wool"; break;
-        
-        // Glass
-        case BLOCK_GLASS: textureName = "glass"; break;
-        case BLOCK_WHITE_STAINED_GLASS: textureName = "white_stained_glass"; break;
-        case BLOCK_ORANGE_STAINED_GLASS: textureName = "orange_stained_glass"; break;
-        case BLOCK_MAGENTA_STAINED_GLASS: textureName = "magenta_stained_glass"; break;
-        case BLOCK_LIGHT_BLUE_STAINED_GLASS: textureName = "light_blue_stained_glass"; break;
-        case BLOCK_YELLOW_STAINED_GLASS: textureName = "yellow_stained_glass"; break;
-        case BLOCK_LIME_STAINED_GLASS: textureName = "lime_stained_glass"; break;
-        case BLOCK_PINK_STAINED_GLASS: textureName = "pink_stained_glass"; break;
-        case BLOCK_GRAY_STAINED_GLASS: textureName = "gray_stained_glass"; break;
-        case BLOCK_LIGHT_GRAY_STAINED_GLASS: textureName = "light_gray_stained_glass"; break;
-        case BLOCK_CYAN_STAINED_GLASS: textureName = "cyan_stained_glass"; break;
-        case BLOCK_PURPLE_STAINED_GLASS: textureName = "purple_stained_glass"; break;
-        case BLOCK_BLUE_STAINED_GLASS: textureName = "blue_stained_glass"; break;
-        case BLOCK_BROWN_STAINED_GLASS: textureName = "brown_stained_glass"; break;
-        case BLOCK_GREEN_STAINED_GLASS: textureName = "green_stained_glass"; break;
-        case BLOCK_RED_STAINED_GLASS: textureName = "red_stained_glass"; break;
-        case BLOCK_BLACK_STAINED_GLASS: textureName = "black_stained_glass"; break;
-        
-        // Special blocks
-        case BLOCK_BRICKS: textureName = "bricks"; break;
-        case BLOCK_BOOKSHELF: 
-            if (faceIndex == FACE_TOP || faceIndex == FACE_BOTTOM) textureName = "oak_planks";
-            else textureName = "bookshelf";
-            break;
-        case BLOCK_CRAFTING_TABLE:
-            if (faceIndex == FACE_TOP) textureName = "crafting_table_top";
-            else if (faceIndex == FACE_BOTTOM) textureName = "oak_planks";
-            else textureName = "crafting_table_side";
-            break;
-        case BLOCK_FURNACE: textureName = "furnace_side"; break;
-        case BLOCK_CHEST: textureName = "chest"; break;
-        case BLOCK_GLOWSTONE: textureName = "glowstone"; break;
-        case BLOCK_OBSIDIAN: textureName = "obsidian"; break;
-        case BLOCK_NETHERRACK: textureName = "netherrack"; break;
-        case BLOCK_SOUL_SAND: textureName = "soul_sand"; break;
-        case BLOCK_END_STONE: textureName = "end_stone"; break;
-        case BLOCK_PURPUR_BLOCK: textureName = "purpur_block"; break;
-        case BLOCK_QUARTZ_BLOCK: textureName = "quartz_block_side"; break;
-        case BLOCK_PACKED_ICE: textureName = "packed_ice"; break;
-        case BLOCK_BLUE_ICE: textureName = "blue_ice"; break;
-        case BLOCK_ICE: textureName = "ice"; break;
-        case BLOCK_SNOW_BLOCK: textureName = "snow"; break;
-        case BLOCK_CACTUS:
-            if (faceIndex == FACE_TOP) textureName = "cactus_top";
-            else if (faceIndex == FACE_BOTTOM) textureName = "cactus_bottom";
-            else textureName = "cactus_side";
-            break;
-        case BLOCK_PUMPKIN: textureName = "pumpkin_side"; break;
-        case BLOCK_JACK_O_LANTERN: 
-            if (faceIndex == FACE_FRONT) textureName = "jack_o_lantern";
-            else textureName = "pumpkin_side";
-            break;
-        case BLOCK_MELON: textureName = "melon_side"; break;
-        case BLOCK_HAY_BLOCK:
-            if (faceIndex == FACE_TOP || faceIndex == FACE_BOTTOM) textureName = "hay_block_top";
-            else textureName = "hay_block_side";
-            break;
-        
-        default: textureName = "stone"; break;
-    }
-    
-    int textureIndex = GetTextureIndex(textureName);
+    int textureIndex = GetBlockTextureIndex(block, faceIndex);
     *u = textureManager.texCoords[textureIndex][0];
     *v = textureManager.texCoords[textureIndex][1];
     *w = textureManager.texCoords[textureIndex][2];
     *h = textureManager.texCoords[textureIndex][3];
 }
 
+static int GetBlockTextureIndex(BlockType block, int faceIndex) {
+    if ((unsigned int)block >= BLOCK_COUNT) block = BLOCK_STONE;
+    return blockTextures.faces[block][faceIndex];
+}
+
 bool BlockNeedsAlphaBlending(BlockType block) {
     switch (block) {
         case BLOCK_GLASS:
@@ -818,14 +2378,42 @@ bool BlockNeedsAlphaBlending(BlockType block) {
         case BLOCK_DARK_OAK_LEAVES:
         case BLOCK_ICE:
         case BLOCK_WATER:
+        case BLOCK_WHEAT:
+        case BLOCK_REDSTONE_WIRE:
+        case BLOCK_REDSTONE_TORCH:
+        case BLOCK_LEVER:
             return true;
         default:
             return false;
     }
 }
 
+// Directory of the block connected texture tiles under optifine/ctm, NULL if the block does not connect
+const char* GetConnectedTextureSet(BlockType block) {
+    switch (block) {
+        case BLOCK_GLASS: return "glass_clear";
+        case BLOCK_WHITE_STAINED_GLASS: return "glass_stained/glass_white";
+        case BLOCK_ORANGE_STAINED_GLASS: return "glass_stained/glass_orange";
+        case BLOCK_MAGENTA_STAINED_GLASS: return "glass_stained/glass_magenta";
+        case BLOCK_LIGHT_BLUE_STAINED_GLASS: return "glass_stained/glass_light_blue";
+        case BLOCK_YELLOW_STAINED_GLASS: return "glass_stained/glass_yellow";
+        case BLOCK_LIME_STAINED_GLASS: return "glass_stained/glass_lime";
+        case BLOCK_PINK_STAINED_GLASS: return "glass_stained/glass_pink";
+        case BLOCK_GRAY_STAINED_GLASS: return "glass_stained/glass_gray";
+        case BLOCK_LIGHT_GRAY_STAINED_GLASS: return "glass_stained/glass_silver";
+        case BLOCK_CYAN_STAINED_GLASS: return "glass_stained/glass_cyan";
+        case BLOCK_PURPLE_STAINED_GLASS: return "glass_stained/glass_purple";
+        case BLOCK_BLUE_STAINED_GLASS: return "glass_stained/glass_blue";
+        case BLOCK_BROWN_STAINED_GLASS: return "glass_stained/glass_brown";
+        case BLOCK_GREEN_STAINED_GLASS: return "glass_stained/glass_green";
+        case BLOCK_RED_STAINED_GLASS: return "glass_stained/glass_red";
+        case BLOCK_BLACK_STAINED_GLASS: return "glass_stained/glass_black";
+        default: return NULL;
+    }
+}
+
 const char* GetBlockTextureName(BlockType block, int faceIndex) {
-    // Map block types and faces to texture names (same logic as GetBlockTextureUV)
+    // Map block types and faces to texture names, every name returned here is packed in the atlas (blockTextureNames)
     switch (block) {
         case BLOCK_GRASS:
             if (faceIndex == FACE_TOP) return "grass_block_top";
@@ -868,7 +2456,7 @@ const char* GetBlockTextureName(BlockType block, int faceIndex) {
         case BLOCK_GRANITE: return "granite";
         case BLOCK_DIORITE: return "diorite";
         case BLOCK_MOSSY_COBBLESTONE: return "mossy_cobblestone";
-        case BLOCK_SMOOTH_STONE: return "smooth_stone";
+        case BLOCK_SMOOTH_STONE: return "stone_slab_top";     // Smooth stone texture of this pack
         
         // Sandstone
         case BLOCK_SANDSTONE:
@@ -945,7 +2533,7 @@ const char* GetBlockTextureName(BlockType block, int faceIndex) {
             else if (faceIndex == FACE_BOTTOM) return "oak_planks";
             else return "crafting_table_side";
         case BLOCK_FURNACE: return "furnace_side";
-        case BLOCK_CHEST: return "chest";
+        case BLOCK_CHEST: return "oak_planks";                // Chests have no block texture, only an entity model
         case BLOCK_GLOWSTONE: return "glowstone";
         case BLOCK_OBSIDIAN: return "obsidian";
         case BLOCK_NETHERRACK: return "netherrack";
@@ -956,6 +2544,11 @@ const char* GetBlockTextureName(BlockType block, int faceIndex) {
         case BLOCK_PACKED_ICE: return "packed_ice";
         case BLOCK_BLUE_ICE: return "blue_ice";
         case BLOCK_ICE: return "ice";
+        case BLOCK_WHEAT: return "wheat_stage7";
+        case BLOCK_REDSTONE_WIRE: return "redstone_dust_dot";
+        case BLOCK_REDSTONE_TORCH: return "redstone_torch";
+        case BLOCK_LEVER: return "lever";
+        case BLOCK_REDSTONE_LAMP: return "redstone_lamp";
         case BLOCK_SNOW_BLOCK: return "snow";
         case BLOCK_CACTUS:
             if (faceIndex == FACE_TOP) return "cactus_top";
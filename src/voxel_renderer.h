@@ -3,28 +3,86 @@
 
 #include "voxel_types.h"
 #include "voxel_world.h"
+#include "render_stats.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+//----------------------------------------------------------------------------------
+// Render Packet
+// NOTE: Built by the simulation thread, consumed by the main thread (which owns the GL
+// context). Chunks are referenced by world slot index, GPU meshes live in the renderer.
+//----------------------------------------------------------------------------------
+typedef enum {
+    RENDER_COMMAND_UPLOAD_MESH = 0,     // Upload CPU geometry into a chunk slot
+    RENDER_COMMAND_RELEASE_MESH         // Free GPU geometry of a slot whose chunk unloaded
+} RenderCommandType;
+
+typedef struct {
+    RenderCommandType type;
+    int chunkIndex;                     // Slot in VoxelWorld.chunks
+    ChunkPos position;                  // Chunk the uploaded geometry belongs to
+    int section;                        // Chunk section the uploaded geometry covers
+    Mesh opaqueMesh;                    // CPU-side geometry, ownership moves to the renderer
+    Mesh transparentMesh;
+    Mesh liquidMesh;
+} RenderCommand;
+
+typedef struct {
+    int chunkIndex;
+    ChunkPos chunkPosition;             // Chunk expected in the slot, stale GPU meshes are skipped
+    Vector3 position;                   // Chunk world position at packet build time
+    float distance;                     // Distance to camera, used for sorting
+} ChunkDrawItem;
+
+typedef struct {
+    Camera3D camera;
+    float daylight;                     // Sun brightness at the world time of day, 0 night to 1 day
+    float animationTicks;               // Frame clock of animated textures (ticks, wraps daily for float precision)
+    ChunkDrawItem drawList[MAX_CHUNKS]; // Visible chunks sorted front to back
+    int drawCount;
+    RenderCommand* commands;            // GPU resource commands, handed to the frame scheduler in order
+    int commandCount;
+    int commandCapacity;
+    RenderStats stats;                  // Counters gathered while building the packet
+} RenderPacket;
+
+// Texture atlas build times in milliseconds (RunAtlasCacheBenchmark)
+typedef struct {
+    double coldTime;                    // Decode and pack every image, rewrite the cache
+    double warmTime;                    // Read the cache back
+} AtlasCacheTimes;
+
 //----------------------------------------------------------------------------------
 // Rendering Functions
 //----------------------------------------------------------------------------------
 void InitVoxelRenderer(void);
-void RenderVoxelWorld(VoxelWorld* world, Camera3D camera);
-void RenderChunk(Chunk* chunk, Camera3D camera);
-void UpdateChunkMesh(Chunk* chunk, VoxelWorld* world);
 void UnloadVoxelRenderer(void);
 
+// Simulation thread: cull, mesh dirty chunks and record draw list plus GPU commands
+void BuildRenderPacket(RenderPacket* packet, VoxelWorld* world, Camera3D camera);
+void UnloadRenderPacket(RenderPacket* packet);
+void WaitForMeshJobs(void);     // Finish in-flight mesh jobs and drop their results
+
+// Main thread: queue the packet GPU commands on the frame scheduler, then draw
+// NOTE: Commands run time-sliced by RunFrameTasks(), meshes appear once uploaded
+void SubmitRenderCommands(RenderPacket* packet);
+void RenderVoxelWorld(const RenderPacket* packet);
+
 // Texture management
 void InitTextureManager(void);
-void LoadBlockTextures(void);
+void LoadBlockTextures(void);                                           // From the atlas cache when inputs are unchanged
+AtlasCacheTimes RunAtlasCacheBenchmark(void);
 void UnloadTextureManager(void);
-int GetTextureIndex(const char* textureName);
+int GetTextureIndex(const char* textureName);                            // -1 if the atlas has no such texture
+void LoadBiomeColormaps(void);          // Grass, foliage, swamp and birch tint colormaps
+void UnloadBiomeColormaps(void);
 void GetBlockTextureUV(BlockType block, int faceIndex, float* u, float* v, float* w, float* h);
 Texture2D GetTextureAtlas(void);
 bool ValidateTextureManager(void);
+bool FindResourcePath(const char* relativePath, char* path, int size);  // Path under resources/ that exists
+const char* GetConnectedTextureSet(BlockType block);                    // optifine/ctm tile directory, NULL if none
 
 // Block transparency and alpha blending
 bool BlockNeedsAlphaBlending(BlockType block);
@@ -32,16 +90,21 @@ bool BlockNeedsAlphaBlending(BlockType block);
 // Debug functions
 const char* GetBlockTextureName(BlockType block, int faceIndex);
 
-// Mesh generation
-void GenerateChunkMesh(Chunk* chunk, VoxelWorld* world);
+// Mesh generation (one CHUNK_SECTION_HEIGHT slice of the chunk)
+bool BuildChunkMesh(const ChunkNeighborhood* neighborhood, int section, Mesh* opaqueMesh, Mesh* transparentMesh,
+                    Mesh* liquidMesh, volatile int* cancelToken);   // Returns false if cancelled (meshes left empty)
 void AddFaceToMesh(Vector3 position, int faceIndex, BlockType block, 
                    float* vertices, float* texCoords, int* vertexIndex);
-bool ShouldRenderFace(VoxelWorld* world, BlockPos position, int faceIndex);
+void AddCrossToMesh(Vector3 position, int textureIndex, float* vertices, float* texCoords,
+                    unsigned short* indices, int* vertexIndex, int* indexIndex);
+bool ShouldRenderFace(const ChunkNeighborhood* neighborhood, int x, int y, int z);
+
+// Microbenchmark: remesh every section of the loaded chunks on the calling thread, returns milliseconds per section
+double RunMesherBenchmark(VoxelWorld* world);
 
 // Culling and optimization
 bool IsChunkInFrustum(Chunk* chunk, Camera3D camera);
 void FrustumCullChunks(VoxelWorld* world, Camera3D camera);
-void SortChunksByDistance(VoxelWorld* world, Vector3 playerPosition);
 
 // Face indices for cube faces
 #define FACE_FRONT  0
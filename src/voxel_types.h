@@ -13,16 +13,37 @@
 #define RENDER_DISTANCE 8
 #define MAX_CHUNKS 256
 
+// Chunks are meshed in horizontal sections, edits only rebuild the sections they touch
+#define CHUNK_SECTION_HEIGHT 16
+#define CHUNK_SECTIONS (WORLD_HEIGHT/CHUNK_SECTION_HEIGHT)
+#define CHUNK_SECTIONS_ALL ((1u << CHUNK_SECTIONS) - 1)
+
+// Light levels are 4-bit, stored two per byte per section
+#define MAX_LIGHT_LEVEL 15
+#define SECTION_LIGHT_BYTES (CHUNK_SIZE*CHUNK_SIZE*CHUNK_SECTION_HEIGHT/2)
+
+// Simulation timing (fixed-rate ticks, decoupled from render frame rate)
+#define SIMULATION_TICK_RATE 60
+#define SIMULATION_TICK_TIME (1.0f/SIMULATION_TICK_RATE)
+#define MAX_TICKS_PER_FRAME 5       // Catch-up cap, avoids spiral of death after a stall
+
+// Day/night cycle
+#define DAY_LENGTH_TICKS (20*60*SIMULATION_TICK_RATE)     // 20 minutes per day
+#define DAY_START_TIME 0.3f                                 // Time of day of a new world, early morning
+
 // World generation constants
 #define TERRAIN_SCALE 0.01f
 #define TERRAIN_HEIGHT 32
 #define WATER_LEVEL 62
 #define TREE_FREQUENCY 0.05f
+#define CLIMATE_SCALE 0.004f        // Temperature and humidity noise, biomes span a few hundred blocks
+#define SWAMP_HUMIDITY 210          // Columns at least this humid (0-255) and low enough turn to swamp
+#define SWAMP_MAX_HEIGHT (WATER_LEVEL + 3)
 
 //----------------------------------------------------------------------------------
 // Texture Management
 //----------------------------------------------------------------------------------
-#define MAX_BLOCK_TEXTURES 512
+#define MAX_BLOCK_TEXTURES 1024     // Block textures plus 47 tile connected texture sets
 #define TEXTURE_ATLAS_SIZE 1024
 #define TEXTURE_SIZE 16  // Each texture is 16x16 pixels
 
@@ -218,6 +239,15 @@ typedef enum {
     BLOCK_SPONGE,
     BLOCK_WET_SPONGE,
     
+    // Plants (state in block data)
+    BLOCK_WHEAT,                // Growth stage 0..7
+    
+    // Redstone components (state in block data)
+    BLOCK_REDSTONE_WIRE,        // Powered flag
+    BLOCK_REDSTONE_TORCH,       // Lit flag
+    BLOCK_LEVER,                // On flag
+    BLOCK_REDSTONE_LAMP,        // Lit flag
+    
     BLOCK_COUNT
 } BlockType;
 
@@ -235,33 +265,46 @@ typedef struct {
 //----------------------------------------------------------------------------------
 // Chunk Data Structure
 //----------------------------------------------------------------------------------
+typedef enum {
+    CHUNK_GEN_PENDING = 0,      // Terrain job queued or running
+    CHUNK_GEN_DONE,             // Terrain written by a job, not announced to neighbors yet
+    CHUNK_GEN_READY             // Visible to gameplay, physics and rendering
+} ChunkGenState;
+
+// Biome climate of a block column, picks the grass and foliage colormap tint
+typedef struct {
+    unsigned char temperature;  // 0 cold to 255 hot
+    unsigned char humidity;     // 0 dry to 255 wet
+    bool swamp;                 // Humid lowland, tinted by the swamp colormaps
+} ColumnClimate;
+
 typedef struct {
     ChunkPos position;
     BlockType blocks[CHUNK_SIZE][WORLD_HEIGHT][CHUNK_SIZE];
-    bool needsRegen;
+    unsigned char blockData[CHUNK_SIZE][WORLD_HEIGHT][CHUNK_SIZE];     // Per-block state (fluid level...)
+    unsigned int dirtySections; // Bit per section whose mesh is out of date
+    unsigned short randomTickBlocks[CHUNK_SECTIONS];    // Randomly ticked blocks per section (0 skips sampling)
+    unsigned char skyLight[CHUNK_SECTIONS][SECTION_LIGHT_BYTES];    // Skylight nibbles (see world_lighting.h)
+    unsigned char blockLight[CHUNK_SECTIONS][SECTION_LIGHT_BYTES];  // Emitted light nibbles
+    ColumnClimate climate[CHUNK_SIZE][CHUNK_SIZE];                  // Written once by terrain generation
     bool isLoaded;
     bool isVisible;
     
-    // Rendering data
-    Mesh mesh;                      // Opaque blocks mesh
-    Material material;              // Opaque blocks material
-    bool hasMesh;
-    int vertexCount;
-    int triangleCount;
+    // Async access (job system)
+    volatile int genState;      // ChunkGenState, advanced by the generation job
+    volatile int refCount;      // Pins held by in-flight jobs, the slot is not reused while > 0
+    volatile int cancelled;     // Cancellation token, set on unload so queued jobs skip their work
+    unsigned int version;       // Content version, bumped on every edit (never reset per slot)
     
-    // Transparent rendering data
-    Mesh transparentMesh;           // Transparent blocks mesh
-    Material transparentMaterial;   // Transparent blocks material
-    int transparentVertexCount;
-    int transparentTriangleCount;
+    // NOTE: GPU meshes are owned by the renderer (main thread), indexed by chunk slot
 } Chunk;
 
 //----------------------------------------------------------------------------------
 // Inventory System
 //----------------------------------------------------------------------------------
-#define INVENTORY_SIZE 45  // 9x5 grid
+#define INVENTORY_SIZE 54  // 9x6 grid
 #define HOTBAR_SIZE 9
-#define INVENTORY_ROWS 5
+#define INVENTORY_ROWS 6
 #define INVENTORY_COLS 9
 
 typedef struct {
@@ -276,6 +319,7 @@ typedef struct {
     Camera3D camera;
     Vector3 velocity;
     Vector3 position;
+    Vector3 previousPosition;   // Position at previous simulation tick (render interpolation)
     bool onGround;
     bool inWater;
     
@@ -291,10 +335,13 @@ typedef struct {
     
     // Block interaction
     BlockPos targetBlock;
+    Vector3 targetNormal;       // Face of the target block hit by the view ray
     bool hasTarget;
     BlockType selectedBlock;
     int hotbarSlot;
     BlockType hotbar[9];
+    bool breakRequested;        // Set by input on the main thread, consumed by the simulation
+    bool placeRequested;
     
     // Inventory system
     Inventory inventory;
@@ -344,14 +391,57 @@ static inline float Distance2D(Vector3 a, Vector3 b)
     return sqrtf(dx*dx + dz*dz);
 }
 
+// Sun brightness at a time of day (0 midnight, 0.5 noon): 1 through the day, 0 through the night,
+// ramping around sunrise and sunset
+static inline float GetDaylight(float timeOfDay)
+{
+    float daylight = cosf((timeOfDay - 0.5f)*2.0f*PI)*2.0f + 0.5f;
+    return (daylight < 0.0f)? 0.0f : (daylight > 1.0f)? 1.0f : daylight;
+}
+
+// Sections whose mesh sees a block at height y (its own, plus the adjacent one on a boundary)
+static inline unsigned int GetSectionMask(int y)
+{
+    int section = y/CHUNK_SECTION_HEIGHT;
+    unsigned int mask = 1u << section;
+    
+    if ((y % CHUNK_SECTION_HEIGHT == 0) && (section > 0)) mask |= 1u << (section - 1);
+    if ((y % CHUNK_SECTION_HEIGHT == CHUNK_SECTION_HEIGHT - 1) && (section < CHUNK_SECTIONS - 1)) mask |= 1u << (section + 1);
+    
+    return mask;
+}
+
 //----------------------------------------------------------------------------------
 // Block Properties
 //----------------------------------------------------------------------------------
 static inline bool IsBlockSolid(BlockType block)
+{
+    return (block != BLOCK_AIR &&
+            block != BLOCK_WATER &&
+            block != BLOCK_WHEAT &&
+            block != BLOCK_REDSTONE_WIRE &&
+            block != BLOCK_REDSTONE_TORCH &&
+            block != BLOCK_LEVER);
+}
+
+// Blocks the player can aim at (solid or not)
+static inline bool IsBlockTargetable(BlockType block)
 {
     return (block != BLOCK_AIR && block != BLOCK_WATER);
 }
 
+// Blocks reacting to random ticks (grass spread, leaf decay, crop growth, ice melt)
+static inline bool IsBlockRandomTicked(BlockType block)
+{
+    return (block == BLOCK_GRASS ||
+            block == BLOCK_OAK_LEAVES ||
+            block == BLOCK_BIRCH_LEAVES ||
+            block == BLOCK_ACACIA_LEAVES ||
+            block == BLOCK_DARK_OAK_LEAVES ||
+            block == BLOCK_WHEAT ||
+            block == BLOCK_ICE);
+}
+
 static inline bool IsBlockTransparent(BlockType block)
 {
     return (block == BLOCK_AIR || 
@@ -377,7 +467,36 @@ static inline bool IsBlockTransparent(BlockType block)
             block == BLOCK_BIRCH_LEAVES ||
             block == BLOCK_ACACIA_LEAVES ||
             block == BLOCK_DARK_OAK_LEAVES ||
-            block == BLOCK_ICE);
+            block == BLOCK_ICE ||
+            block == BLOCK_WHEAT ||
+            block == BLOCK_REDSTONE_WIRE ||
+            block == BLOCK_REDSTONE_TORCH ||
+            block == BLOCK_LEVER);
+}
+
+// Light a block absorbs on top of the one level lost per block travelled
+static inline int GetBlockLightOpacity(BlockType block)
+{
+    if (block == BLOCK_WATER ||
+        block == BLOCK_ICE ||
+        block == BLOCK_OAK_LEAVES ||
+        block == BLOCK_BIRCH_LEAVES ||
+        block == BLOCK_ACACIA_LEAVES ||
+        block == BLOCK_DARK_OAK_LEAVES) return 1;
+    
+    return (IsBlockSolid(block) && !IsBlockTransparent(block))? MAX_LIGHT_LEVEL : 0;
+}
+
+// Light level a block emits into its own cell
+static inline int GetBlockLightEmission(BlockType block)
+{
+    switch (block) {
+        case BLOCK_GLOWSTONE: return 15;
+        case BLOCK_SEA_LANTERN: return 15;
+        case BLOCK_JACK_O_LANTERN: return 15;
+        case BLOCK_MAGMA_BLOCK: return 3;
+        default: return 0;
+    }
 }
 
 static inline Color GetBlockColor(BlockType block)
@@ -549,6 +668,13 @@ static inline Color GetBlockColor(BlockType block)
         case BLOCK_SPONGE: return (Color){193, 193, 57, 255};
         case BLOCK_WET_SPONGE: return (Color){170, 170, 51, 255};
         
+        // Plants
+        case BLOCK_WHEAT: return (Color){166, 151, 73, 255};
+        case BLOCK_REDSTONE_WIRE: return (Color){171, 20, 4, 255};
+        case BLOCK_REDSTONE_TORCH: return (Color){221, 48, 23, 255};
+        case BLOCK_LEVER: return (Color){112, 96, 74, 255};
+        case BLOCK_REDSTONE_LAMP: return (Color){142, 88, 52, 255};
+        
         default: return WHITE;
     }
 }
@@ -1,28 +1,123 @@
 #include "voxel_world.h"
 #include "world_generation.h"
+#include "world_lighting.h"
+#include "job_system.h"
+#include "platform_threads.h"
 #include "raymath.h"
 #include <string.h>
 #include <stdlib.h>
 
+//----------------------------------------------------------------------------------
+// Module Internal Functions
+//----------------------------------------------------------------------------------
+// Any chunk occupying a world position, generated or not
+static Chunk* FindChunk(VoxelWorld* world, ChunkPos position) {
+    for (int i = 0; i < MAX_CHUNKS; i++) {
+        if (world->chunks[i].isLoaded && 
+            ChunkPosEqual(world->chunks[i].position, position)) {
+            return &world->chunks[i];
+        }
+    }
+    return NULL;
+}
+
+static void MarkChunkForRegen(VoxelWorld* world, ChunkPos position) {
+    Chunk* chunk = GetChunk(world, position);
+    if (chunk) chunk->dirtySections = CHUNK_SECTIONS_ALL;
+}
+
+// Neighbors and diagonals meshed their border against empty space, rebuild them
+static void MarkNeighborsForRegen(VoxelWorld* world, ChunkPos position) {
+    for (int dx = -1; dx <= 1; dx++) {
+        for (int dz = -1; dz <= 1; dz++) {
+            if (dx || dz) MarkChunkForRegen(world, (ChunkPos){position.x + dx, position.z + dz});
+        }
+    }
+}
+
+// Mark the sections of a neighbor chunk that see an edited border block, as in the chunk itself
+static void MarkNeighborSection(VoxelWorld* world, ChunkPos position, int y) {
+    Chunk* chunk = GetChunk(world, position);
+    if (chunk) chunk->dirtySections |= GetSectionMask(y);
+}
+
+// Write a block into a generated chunk, local coordinates
+// NOTE: Several edits in a tick only set section bits, each section is remeshed once
+static void WriteBlock(VoxelWorld* world, Chunk* chunk, int localX, int y, int localZ, BlockType block, unsigned char data) {
+    BlockType previous = chunk->blocks[localX][y][localZ];
+    
+    // Keep the per-section random tick counts in sync
+    int section = y/CHUNK_SECTION_HEIGHT;
+    if (IsBlockRandomTicked(previous)) chunk->randomTickBlocks[section]--;
+    if (IsBlockRandomTicked(block)) chunk->randomTickBlocks[section]++;
+    
+    chunk->blocks[localX][y][localZ] = block;
+    chunk->blockData[localX][y][localZ] = data;
+    chunk->version++;
+    MarkBlockDirty(world, chunk, localX, y, localZ);
+    
+    // Relight around blocks that let through or emit a different amount of light
+    if ((GetBlockLightOpacity(previous) != GetBlockLightOpacity(block)) ||
+        (GetBlockLightEmission(previous) != GetBlockLightEmission(block))) {
+        UpdateLightAt(world, (BlockPos){ chunk->position.x*CHUNK_SIZE + localX, y, chunk->position.z*CHUNK_SIZE + localZ }, previous);
+    }
+}
+
+// Count randomly ticked blocks per section of freshly generated terrain
+static void CountRandomTickBlocks(Chunk* chunk) {
+    memset(chunk->randomTickBlocks, 0, sizeof(chunk->randomTickBlocks));
+    
+    for (int x = 0; x < CHUNK_SIZE; x++) {
+        for (int y = 0; y < WORLD_HEIGHT; y++) {
+            for (int z = 0; z < CHUNK_SIZE; z++) {
+                if (IsBlockRandomTicked(chunk->blocks[x][y][z])) chunk->randomTickBlocks[y/CHUNK_SECTION_HEIGHT]++;
+            }
+        }
+    }
+}
+
+// Publish chunks whose generation job finished since the last tick
+static void PublishGeneratedChunks(VoxelWorld* world) {
+    for (int i = 0; i < MAX_CHUNKS; i++) {
+        Chunk* chunk = &world->chunks[i];
+        if (!chunk->isLoaded) continue;
+        if (!AtomicCompareExchange(&chunk->genState, CHUNK_GEN_DONE, CHUNK_GEN_READY)) continue;
+        
+        // Light was filled inside the chunk by the job, carry it across the borders
+        StitchChunkLight(world, chunk);
+        
+        chunk->dirtySections = CHUNK_SECTIONS_ALL;
+        MarkNeighborsForRegen(world, chunk->position);
+    }
+}
+
 //----------------------------------------------------------------------------------
 // World Management Functions
 //----------------------------------------------------------------------------------
 void InitVoxelWorld(VoxelWorld* world) {
     world->chunkCount = 0;
     world->playerPosition = (Vector3){0, 70, 0};
+    world->tickCount = 0;
+    world->timeOfDay = DAY_START_TIME;
+    world->generationJobs = (JobCounter){0};
+    for (int i = 0; i < MAX_CHUNKS; i++) world->terrainJobs[i] = (JobCounter){0};
+    world->generationsCancelled = 0;
     
     // Initialize all chunks
     for (int i = 0; i < MAX_CHUNKS; i++) {
         world->chunks[i].isLoaded = false;
-        world->chunks[i].hasMesh = false;
-        world->chunks[i].needsRegen = false;
+        world->chunks[i].dirtySections = 0;
         world->chunks[i].isVisible = false;
+        world->chunks[i].genState = CHUNK_GEN_PENDING;
+        world->chunks[i].refCount = 0;
+        world->chunks[i].cancelled = 0;
+        world->chunks[i].version = 0;
         world->chunks[i].position = (ChunkPos){0, 0};
-        world->chunks[i].vertexCount = 0;
-        world->chunks[i].triangleCount = 0;
-        world->chunks[i].transparentVertexCount = 0;
-        world->chunks[i].transparentTriangleCount = 0;
         memset(world->chunks[i].blocks, BLOCK_AIR, sizeof(world->chunks[i].blocks));
+        memset(world->chunks[i].blockData, 0, sizeof(world->chunks[i].blockData));
+        memset(world->chunks[i].randomTickBlocks, 0, sizeof(world->chunks[i].randomTickBlocks));
+        memset(world->chunks[i].skyLight, 0, sizeof(world->chunks[i].skyLight));
+        memset(world->chunks[i].blockLight, 0, sizeof(world->chunks[i].blockLight));
     }
     
     InitWorldGeneration();
@@ -30,6 +125,11 @@ void InitVoxelWorld(VoxelWorld* world) {
 
 void UpdateVoxelWorld(VoxelWorld* world, Vector3 playerPosition) {
     world->playerPosition = playerPosition;
+    world->tickCount++;
+    world->timeOfDay = fmodf(world->timeOfDay + 1.0f/DAY_LENGTH_TICKS, 1.0f);
+    
+    // Make chunks generated by workers visible to gameplay
+    PublishGeneratedChunks(world);
     
     // Load chunks around player
     LoadChunksAroundPlayer(world, playerPosition);
@@ -39,20 +139,11 @@ void UpdateVoxelWorld(VoxelWorld* world, Vector3 playerPosition) {
 }
 
 void UnloadVoxelWorld(VoxelWorld* world) {
+    // Generation jobs write into chunk slots, let them finish first
+    WaitForChunkGeneration(world);
+    
+    // NOTE: Chunk GPU meshes are released by UnloadVoxelRenderer()
     for (int i = 0; i < MAX_CHUNKS; i++) {
-        if (world->chunks[i].isLoaded && world->chunks[i].hasMesh) {
-            // Unload opaque mesh geometry only
-            if (world->chunks[i].vertexCount > 0) {
-                UnloadMesh(world->chunks[i].mesh);
-            }
-            
-            // Unload transparent mesh geometry only
-            if (world->chunks[i].transparentVertexCount > 0) {
-                UnloadMesh(world->chunks[i].transparentMesh);
-            }
-            
-            world->chunks[i].hasMesh = false;
-        }
         world->chunks[i].isLoaded = false;
     }
     world->chunkCount = 0;
@@ -62,36 +153,24 @@ void UnloadVoxelWorld(VoxelWorld* world) {
 // Chunk Management Functions
 //----------------------------------------------------------------------------------
 Chunk* GetChunk(VoxelWorld* world, ChunkPos position) {
-    for (int i = 0; i < MAX_CHUNKS; i++) {
-        if (world->chunks[i].isLoaded && 
-            ChunkPosEqual(world->chunks[i].position, position)) {
-            return &world->chunks[i];
-        }
-    }
-    return NULL;
+    Chunk* chunk = FindChunk(world, position);
+    if (chunk && (AtomicLoad(&chunk->genState) != CHUNK_GEN_READY)) return NULL;
+    return chunk;
 }
 
-Chunk* LoadChunk(VoxelWorld* world, ChunkPos position) {
-    // Check if chunk already exists
-    Chunk* existing = GetChunk(world, position);
-    if (existing) return existing;
-    
-    // Find empty slot
+// Claim a free slot for a chunk, terrain is not generated yet
+// NOTE: Slots still pinned by jobs reading a previously unloaded chunk are skipped
+static Chunk* AllocateChunk(VoxelWorld* world, ChunkPos position) {
     for (int i = 0; i < MAX_CHUNKS; i++) {
-        if (!world->chunks[i].isLoaded) {
+        if (!world->chunks[i].isLoaded && (AtomicLoad(&world->chunks[i].refCount) == 0)) {
             Chunk* chunk = &world->chunks[i];
             chunk->position = position;
             chunk->isLoaded = true;
-            chunk->needsRegen = true;
-            chunk->hasMesh = false;
+            chunk->dirtySections = CHUNK_SECTIONS_ALL;
             chunk->isVisible = false;
-            chunk->vertexCount = 0;
-            chunk->triangleCount = 0;
-            chunk->transparentVertexCount = 0;
-            chunk->transparentTriangleCount = 0;
-            
-            // Generate chunk terrain
-            GenerateChunk(chunk);
+            chunk->genState = CHUNK_GEN_PENDING;
+            chunk->cancelled = 0;
+            chunk->version++;           // Results of jobs for the previous occupant never match
             
             world->chunkCount++;
             return chunk;
@@ -101,37 +180,69 @@ Chunk* LoadChunk(VoxelWorld* world, ChunkPos position) {
     return NULL; // No free slots
 }
 
+// First half of a generation, LightChunkJob() runs as its continuation
+static void GenerateChunkJob(void* userData) {
+    Chunk* chunk = (Chunk*)userData;
+    
+    // Chunk unloaded while queued (player moved away): skip the work, the lighting job drops the pin
+    if (AtomicLoad(&chunk->cancelled)) return;
+    
+    GenerateChunk(chunk);
+    CountRandomTickBlocks(chunk);
+}
+
+static void LightChunkJob(void* userData) {
+    Chunk* chunk = (Chunk*)userData;
+    
+    if (!AtomicLoad(&chunk->cancelled)) {
+        ComputeChunkLight(chunk);
+        
+        // Simulation thread publishes the chunk on its next tick
+        AtomicStore(&chunk->genState, CHUNK_GEN_DONE);
+    }
+    ReleaseChunk(chunk);
+}
+
+Chunk* LoadChunk(VoxelWorld* world, ChunkPos position) {
+    // Check if chunk already exists (still generating chunks can not be used yet)
+    Chunk* existing = FindChunk(world, position);
+    if (existing) return (AtomicLoad(&existing->genState) == CHUNK_GEN_READY)? existing : NULL;
+    
+    Chunk* chunk = AllocateChunk(world, position);
+    if (!chunk) return NULL;
+    
+    // Generate chunk terrain synchronously, neighbors get remeshed on next publish
+    GenerateChunk(chunk);
+    CountRandomTickBlocks(chunk);
+    ComputeChunkLight(chunk);
+    chunk->genState = CHUNK_GEN_READY;
+    StitchChunkLight(world, chunk);
+    MarkNeighborsForRegen(world, position);
+    
+    return chunk;
+}
+
 void UnloadChunk(VoxelWorld* world, int index) {
     if (index < 0 || index >= MAX_CHUNKS) return;
     
     Chunk* chunk = &world->chunks[index];
     if (!chunk->isLoaded) return;
     
-    // Unload mesh and material if they exist
-    if (chunk->hasMesh) {
-        // Unload opaque mesh geometry only
-        if (chunk->vertexCount > 0) {
-            UnloadMesh(chunk->mesh);
-        }
-        
-        // Unload transparent mesh geometry only
-        if (chunk->transparentVertexCount > 0) {
-            UnloadMesh(chunk->transparentMesh);
-        }
-        
-        chunk->hasMesh = false;
-    }
-    
+    // NOTE: The renderer notices the freed slot and releases its GPU mesh on the main thread.
+    // Jobs still holding pins keep reading valid data, AllocateChunk() waits for refCount 0
+    AtomicStore(&chunk->cancelled, 1);
+    if (AtomicLoad(&chunk->genState) == CHUNK_GEN_PENDING) world->generationsCancelled++;
     chunk->isLoaded = false;
-    chunk->needsRegen = false;
+    chunk->dirtySections = 0;
     chunk->isVisible = false;
-    chunk->vertexCount = 0;
-    chunk->triangleCount = 0;
-    chunk->transparentVertexCount = 0;
-    chunk->transparentTriangleCount = 0;
     world->chunkCount--;
 }
 
+void WaitForChunkGeneration(VoxelWorld* world) {
+    WaitForCounter(&world->generationJobs);
+    PublishGeneratedChunks(world);
+}
+
 void UnloadDistantChunks(VoxelWorld* world, Vector3 playerPosition) {
     float maxDistance = RENDER_DISTANCE * CHUNK_SIZE * 1.5f; // Add some buffer
     
@@ -176,7 +287,47 @@ BlockType GetBlock(VoxelWorld* world, BlockPos position) {
     return chunk->blocks[localX][position.y][localZ];
 }
 
+BlockType GetBlockCached(VoxelWorld* world, BlockLookupCache* cache, int x, int y, int z) {
+    if ((y < 0) || (y >= WORLD_HEIGHT)) return BLOCK_AIR;
+    
+    // Floor division, chunk coordinates of negative blocks round down
+    ChunkPos chunkPos = { (x >= 0)? x/CHUNK_SIZE : (x + 1)/CHUNK_SIZE - 1,
+                          (z >= 0)? z/CHUNK_SIZE : (z + 1)/CHUNK_SIZE - 1 };
+    
+    // Only search the chunk table when the lookup leaves the cached chunk
+    if (!cache->valid || !ChunkPosEqual(cache->position, chunkPos)) {
+        cache->chunk = GetChunk(world, chunkPos);
+        cache->position = chunkPos;
+        cache->valid = true;
+    }
+    
+    if (!cache->chunk) return BLOCK_AIR;
+    return cache->chunk->blocks[x - chunkPos.x*CHUNK_SIZE][y][z - chunkPos.z*CHUNK_SIZE];
+}
+
+unsigned char GetBlockData(VoxelWorld* world, BlockPos position) {
+    if (!IsValidBlockPosition(position)) return 0;
+    
+    ChunkPos chunkPos = WorldToChunk((Vector3){position.x, position.y, position.z});
+    Chunk* chunk = GetChunk(world, chunkPos);
+    if (!chunk) return 0;
+    
+    return chunk->blockData[position.x - chunkPos.x*CHUNK_SIZE][position.y][position.z - chunkPos.z*CHUNK_SIZE];
+}
+
+unsigned char GetBlockDataCached(VoxelWorld* world, BlockLookupCache* cache, int x, int y, int z) {
+    // Same lookup as the block itself, the cache then points at the right chunk
+    GetBlockCached(world, cache, x, y, z);
+    if (!cache->chunk || (y < 0) || (y >= WORLD_HEIGHT)) return 0;
+    
+    return cache->chunk->blockData[x - cache->position.x*CHUNK_SIZE][y][z - cache->position.z*CHUNK_SIZE];
+}
+
 void SetBlock(VoxelWorld* world, BlockPos position, BlockType block) {
+    SetBlockWithData(world, position, block, 0);
+}
+
+void SetBlockWithData(VoxelWorld* world, BlockPos position, BlockType block, unsigned char data) {
     if (!IsValidBlockPosition(position)) return;
     
     // Get chunk position
@@ -203,31 +354,27 @@ void SetBlock(VoxelWorld* world, BlockPos position, BlockType block) {
         return;
     }
     
-    // Set the block
-    chunk->blocks[localX][position.y][localZ] = block;
-    chunk->needsRegen = true;
+    WriteBlock(world, chunk, localX, position.y, localZ, block, data);
+}
+
+bool SetBlockCached(VoxelWorld* world, BlockLookupCache* cache, int x, int y, int z, BlockType block, unsigned char data) {
+    GetBlockCached(world, cache, x, y, z);
+    if (!cache->chunk || (y < 0) || (y >= WORLD_HEIGHT)) return false;
     
-    // Mark neighboring chunks for regeneration if block is on edge
-    if (localX == 0) {
-        ChunkPos leftChunk = {chunkPos.x - 1, chunkPos.z};
-        Chunk* leftChunkPtr = GetChunk(world, leftChunk);
-        if (leftChunkPtr) leftChunkPtr->needsRegen = true;
-    }
-    if (localX == CHUNK_SIZE - 1) {
-        ChunkPos rightChunk = {chunkPos.x + 1, chunkPos.z};
-        Chunk* rightChunkPtr = GetChunk(world, rightChunk);
-        if (rightChunkPtr) rightChunkPtr->needsRegen = true;
-    }
-    if (localZ == 0) {
-        ChunkPos frontChunk = {chunkPos.x, chunkPos.z - 1};
-        Chunk* frontChunkPtr = GetChunk(world, frontChunk);
-        if (frontChunkPtr) frontChunkPtr->needsRegen = true;
-    }
-    if (localZ == CHUNK_SIZE - 1) {
-        ChunkPos backChunk = {chunkPos.x, chunkPos.z + 1};
-        Chunk* backChunkPtr = GetChunk(world, backChunk);
-        if (backChunkPtr) backChunkPtr->needsRegen = true;
-    }
+    WriteBlock(world, cache->chunk, x - cache->position.x*CHUNK_SIZE, y, z - cache->position.z*CHUNK_SIZE, block, data);
+    return true;
+}
+
+void MarkBlockDirty(VoxelWorld* world, Chunk* chunk, int localX, int y, int localZ) {
+    chunk->dirtySections |= GetSectionMask(y);
+    
+    // Mark neighboring chunks for regeneration if block is on edge, and the diagonal one if it is on a corner
+    ChunkPos chunkPos = chunk->position;
+    int dx = (localX == 0)? -1 : (localX == CHUNK_SIZE - 1)? 1 : 0;
+    int dz = (localZ == 0)? -1 : (localZ == CHUNK_SIZE - 1)? 1 : 0;
+    if (dx) MarkNeighborSection(world, (ChunkPos){chunkPos.x + dx, chunkPos.z}, y);
+    if (dz) MarkNeighborSection(world, (ChunkPos){chunkPos.x, chunkPos.z + dz}, y);
+    if (dx && dz) MarkNeighborSection(world, (ChunkPos){chunkPos.x + dx, chunkPos.z + dz}, y);
 }
 
 bool IsValidBlockPosition(BlockPos position) {
@@ -240,6 +387,8 @@ bool IsValidBlockPosition(BlockPos position) {
 void LoadChunksAroundPlayer(VoxelWorld* world, Vector3 playerPosition) {
     ChunkPos playerChunk = WorldToChunk(playerPosition);
     
+    // New chunks get their slot right away and are generated asynchronously by workers
+    
     // Load chunks in a square around the player
     for (int x = -RENDER_DISTANCE; x <= RENDER_DISTANCE; x++) {
         for (int z = -RENDER_DISTANCE; z <= RENDER_DISTANCE; z++) {
@@ -251,8 +400,19 @@ void LoadChunksAroundPlayer(VoxelWorld* world, Vector3 playerPosition) {
             
             if (distance <= RENDER_DISTANCE * CHUNK_SIZE) {
                 // Load chunk if not already loaded
-                if (!GetChunk(world, chunkPos)) {
-                    LoadChunk(world, chunkPos);
+                if (!FindChunk(world, chunkPos)) {
+                    Chunk* chunk = AllocateChunk(world, chunkPos);
+                    if (chunk) {
+                        // Terrain then light: the lighting job waits on the slot counter, the world
+                        // counter tracks it from submission so WaitForChunkGeneration() sees both
+                        JobCounter* terrainJobs = &world->terrainJobs[chunk - world->chunks];
+                        JobDecl terrainJob = { GenerateChunkJob, chunk };
+                        JobDecl lightJob = { LightChunkJob, chunk };
+                        
+                        AcquireChunk(chunk);    // Released by the lighting job
+                        RunJobs(&terrainJob, 1, terrainJobs);
+                        RunJobsAfter(terrainJobs, &lightJob, 1, &world->generationJobs);
+                    }
                 }
             }
         }
@@ -263,4 +423,63 @@ bool IsChunkInRange(ChunkPos chunkPos, Vector3 playerPosition, float range) {
     Vector3 chunkWorldPos = ChunkToWorld(chunkPos);
     float distance = Distance2D(playerPosition, chunkWorldPos);
     return distance <= range;
-} 
+}
+
+//----------------------------------------------------------------------------------
+// Chunk Lifetime Functions
+//----------------------------------------------------------------------------------
+void AcquireChunk(Chunk* chunk) {
+    AtomicAdd(&chunk->refCount, 1);
+}
+
+void ReleaseChunk(Chunk* chunk) {
+    AtomicAdd(&chunk->refCount, -1);
+}
+
+void AcquireChunkNeighborhood(VoxelWorld* world, Chunk* chunk, ChunkNeighborhood* neighborhood) {
+    const ChunkPos offsets[CHUNK_NEIGHBORS] = { {-1, 0}, {1, 0}, {0, -1}, {0, 1}, {-1, -1}, {1, -1}, {-1, 1}, {1, 1} };
+    
+    neighborhood->center = chunk;
+    AcquireChunk(chunk);
+    
+    for (int i = 0; i < CHUNK_NEIGHBORS; i++) {
+        ChunkPos position = {chunk->position.x + offsets[i].x, chunk->position.z + offsets[i].z};
+        neighborhood->neighbors[i] = GetChunk(world, position);
+        if (neighborhood->neighbors[i]) AcquireChunk(neighborhood->neighbors[i]);
+    }
+}
+
+void ReleaseChunkNeighborhood(ChunkNeighborhood* neighborhood) {
+    for (int i = 0; i < CHUNK_NEIGHBORS; i++) {
+        if (neighborhood->neighbors[i]) ReleaseChunk(neighborhood->neighbors[i]);
+        neighborhood->neighbors[i] = NULL;
+    }
+    
+    if (neighborhood->center) ReleaseChunk(neighborhood->center);
+    neighborhood->center = NULL;
+}
+
+BlockType GetNeighborhoodBlock(const ChunkNeighborhood* neighborhood, int x, int y, int z) {
+    if (y < 0 || y >= WORLD_HEIGHT) return BLOCK_AIR;
+    
+    // Missing neighbors read as empty
+    const Chunk* chunk = GetNeighborhoodColumn(neighborhood, &x, &z);
+    if (!chunk) return BLOCK_AIR;
+    
+    return chunk->blocks[x][y][z];
+}
+
+ColumnClimate GetNeighborhoodClimate(const ChunkNeighborhood* neighborhood, int x, int z) {
+    int localX = x;
+    int localZ = z;
+    const Chunk* chunk = GetNeighborhoodColumn(neighborhood, &localX, &localZ);
+    
+    // Missing neighbors repeat the closest column of the center chunk
+    if (!chunk) {
+        chunk = neighborhood->center;
+        localX = (x < 0)? 0 : (x >= CHUNK_SIZE)? CHUNK_SIZE - 1 : x;
+        localZ = (z < 0)? 0 : (z >= CHUNK_SIZE)? CHUNK_SIZE - 1 : z;
+    }
+    
+    return chunk->climate[localX][localZ];
+}
@@ -2,6 +2,7 @@
 #define VOXEL_WORLD_H
 
 #include "voxel_types.h"
+#include "job_system.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -14,24 +15,78 @@ typedef struct {
     Chunk chunks[MAX_CHUNKS];
     int chunkCount;
     Vector3 playerPosition;
+    unsigned int tickCount;     // Simulation ticks elapsed since world init
+    float timeOfDay;            // Fraction of the day cycle: 0 midnight, 0.25 sunrise, 0.5 noon
+    JobCounter generationJobs;  // Chunk generations in flight, counted until their lighting is done
+    JobCounter terrainJobs[MAX_CHUNKS];     // Per chunk slot, the lighting job continues once it reaches zero
+    int generationsCancelled;   // Generation jobs cancelled by unloads (read and reset by stats)
 } VoxelWorld;
 
+#define CHUNK_NEIGHBORS 8
+
+// Chunk plus its horizontal and diagonal neighbors, pinned while an async job reads them
+typedef struct {
+    Chunk* center;
+    Chunk* neighbors[CHUNK_NEIGHBORS];  // -X, +X, -Z, +Z, then -X-Z, +X-Z, -X+Z, +X+Z (NULL if not loaded)
+} ChunkNeighborhood;
+
+// Remembers the chunk of the previous lookup, for queries walking neighboring cells
+typedef struct {
+    Chunk* chunk;               // NULL if the cached position is not generated
+    ChunkPos position;
+    bool valid;
+} BlockLookupCache;
+
+//----------------------------------------------------------------------------------
+// Neighborhood Lookup
+//----------------------------------------------------------------------------------
+// Chunk holding the local column x/z of a neighborhood, x and z are rewritten to its own coords
+// NOTE: Returns NULL for missing neighbors and columns more than one chunk away
+static inline const Chunk* GetNeighborhoodColumn(const ChunkNeighborhood* neighborhood, int* x, int* z)
+{
+    static const signed char slots[3][3] = { { 4, 0, 6 }, { 2, -1, 3 }, { 5, 1, 7 } };    // [dx + 1][dz + 1]
+    int dx = (*x < 0)? -1 : (*x >= CHUNK_SIZE)? 1 : 0;
+    int dz = (*z < 0)? -1 : (*z >= CHUNK_SIZE)? 1 : 0;
+    *x -= dx*CHUNK_SIZE;
+    *z -= dz*CHUNK_SIZE;
+    if ((*x < 0) || (*x >= CHUNK_SIZE) || (*z < 0) || (*z >= CHUNK_SIZE)) return NULL;
+    
+    int slot = slots[dx + 1][dz + 1];
+    return (slot < 0)? neighborhood->center : neighborhood->neighbors[slot];
+}
+
 //----------------------------------------------------------------------------------
 // World Management Functions
 //----------------------------------------------------------------------------------
 void InitVoxelWorld(VoxelWorld* world);
-void UpdateVoxelWorld(VoxelWorld* world, Vector3 playerPosition);
+void UpdateVoxelWorld(VoxelWorld* world, Vector3 playerPosition);     // Called once per simulation tick
 void UnloadVoxelWorld(VoxelWorld* world);
 
 // Chunk management
-Chunk* GetChunk(VoxelWorld* world, ChunkPos position);
+Chunk* GetChunk(VoxelWorld* world, ChunkPos position);              // Generated chunks only
 Chunk* LoadChunk(VoxelWorld* world, ChunkPos position);
 void UnloadChunk(VoxelWorld* world, int index);
 void UnloadDistantChunks(VoxelWorld* world, Vector3 playerPosition);
+void WaitForChunkGeneration(VoxelWorld* world);
+
+// Chunk lifetime for async readers
+// NOTE: Unloading a pinned chunk only hides it, its slot is reused once all pins are released
+void AcquireChunk(Chunk* chunk);
+void ReleaseChunk(Chunk* chunk);                                    // Safe from any thread
+void AcquireChunkNeighborhood(VoxelWorld* world, Chunk* chunk, ChunkNeighborhood* neighborhood);
+void ReleaseChunkNeighborhood(ChunkNeighborhood* neighborhood);
+BlockType GetNeighborhoodBlock(const ChunkNeighborhood* neighborhood, int x, int y, int z); // Local coords, x/z in [-CHUNK_SIZE, 2*CHUNK_SIZE)
+ColumnClimate GetNeighborhoodClimate(const ChunkNeighborhood* neighborhood, int x, int z);  // Nearest center column if missing
 
 // Block operations
 BlockType GetBlock(VoxelWorld* world, BlockPos position);
-void SetBlock(VoxelWorld* world, BlockPos position, BlockType block);
+BlockType GetBlockCached(VoxelWorld* world, BlockLookupCache* cache, int x, int y, int z);   // Cache starts zeroed
+void SetBlock(VoxelWorld* world, BlockPos position, BlockType block);                // Resets block data
+void SetBlockWithData(VoxelWorld* world, BlockPos position, BlockType block, unsigned char data);
+bool SetBlockCached(VoxelWorld* world, BlockLookupCache* cache, int x, int y, int z, BlockType block, unsigned char data); // Never loads chunks
+unsigned char GetBlockData(VoxelWorld* world, BlockPos position);
+unsigned char GetBlockDataCached(VoxelWorld* world, BlockLookupCache* cache, int x, int y, int z);
+void MarkBlockDirty(VoxelWorld* world, Chunk* chunk, int localX, int y, int localZ);    // Remesh every section seeing the block
 bool IsValidBlockPosition(BlockPos position);
 
 // Chunk loading
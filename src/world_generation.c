@@ -98,8 +98,25 @@ bool ShouldPlaceTree(int x, int z) {
     return (treeNoise > 0.7f && (hash2D(x, z) % 100) < (TREE_FREQUENCY * 100));
 }
 
+// Temperature and humidity from two offset noise fields, low humid columns become swamp
+// NOTE: The noise stays within [0, 0.9] around 0.5, it is stretched to cover most of the colormaps
+ColumnClimate GetColumnClimate(int x, int z, int terrainHeight) {
+    float temperature = 0.5f + (SimplexNoise2D(x*CLIMATE_SCALE + 1000.0f, z*CLIMATE_SCALE) - 0.5f)*1.6f;
+    float humidity = 0.5f + (SimplexNoise2D(x*CLIMATE_SCALE, z*CLIMATE_SCALE - 1000.0f) - 0.5f)*1.6f;
+    
+    ColumnClimate climate = { 0 };
+    climate.temperature = (unsigned char)(Clamp(temperature, 0.0f, 1.0f)*255.0f);
+    climate.humidity = (unsigned char)(Clamp(humidity, 0.0f, 1.0f)*255.0f);
+    climate.swamp = (climate.humidity >= SWAMP_HUMIDITY) && (terrainHeight <= SWAMP_MAX_HEIGHT);
+    return climate;
+}
+
 void PlaceTree(Chunk* chunk, int x, int y, int z) {
-    int treeHeight = 4 + (rand() % 3); // Random height between 4-6
+    // Height between 4-6, hashed from world position so generation is deterministic
+    // and safe to run on several worker threads at once (rand() is shared state)
+    int worldX = chunk->position.x * CHUNK_SIZE + x;
+    int worldZ = chunk->position.z * CHUNK_SIZE + z;
+    int treeHeight = 4 + (int)((unsigned int)hash2D(worldX + 31, worldZ - 17) % 3);
     
     // Place trunk
     for (int i = 0; i < treeHeight; i++) {
@@ -136,6 +153,7 @@ void GenerateChunk(Chunk* chunk) {
     
     // Clear chunk
     memset(chunk->blocks, BLOCK_AIR, sizeof(chunk->blocks));
+    memset(chunk->blockData, 0, sizeof(chunk->blockData));
     
     // Generate terrain for each column in the chunk
     for (int x = 0; x < CHUNK_SIZE; x++) {
@@ -152,6 +170,8 @@ void GenerateChunk(Chunk* chunk) {
             if (height < 0) height = 0;
             if (height >= WORLD_HEIGHT) height = WORLD_HEIGHT - 1;
             
+            chunk->climate[x][z] = GetColumnClimate(worldX, worldZ, height);
+            
             // Generate layers
             for (int y = 0; y <= height; y++) {
                 if (y < height - 3) {
@@ -186,6 +206,5 @@ void GenerateChunk(Chunk* chunk) {
         }
     }
     
-    chunk->needsRegen = true;
-    chunk->isLoaded = true;
+    // NOTE: Slot state (isLoaded, dirtySections) belongs to the world, this may run on a worker
 } 
@@ -15,6 +15,7 @@ void GenerateChunk(Chunk* chunk);
 float GetTerrainHeight(int x, int z);
 float GetSurfaceLevel(int x, int z);
 bool ShouldPlaceTree(int x, int z);
+ColumnClimate GetColumnClimate(int x, int z, int terrainHeight);
 void PlaceTree(Chunk* chunk, int x, int y, int z);
 
 // Noise functions
@@ -0,0 +1,413 @@
+#include "world_lighting.h"
+#include "raylib.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+---------------------------------------------------------------------------------
+World Lighting
+
+Two 4-bit light channels per chunk section, stored as nibble arrays:
+    Sky         sunlight from the top of the world
+    Block       light emitted by glowstone, lanterns and magma
+The mesher shades each vertex with the brighter of the two.
+
+Generation (worker thread, inside the terrain job): the column heightmap marks the lowest
+cell with only clear blocks above it. Every cell from there up gets full skylight, emitting
+blocks get their emission level as block light, then a BFS flood fill seeded at the
+heightmap edges and the emitters spreads both sideways and under overhangs. The fill only
+sees the chunk itself; when the simulation publishes the chunk, StitchChunkLight() pushes
+the border cells that would brighten the other side and runs the same fill across.
+
+Edits (simulation thread): a block whose opacity or emission changes is relit
+incrementally with the two queue algorithm instead of relighting the chunk:
+    Removal     darken the edited cell, then follow every neighbor whose light came from a
+                removed cell (dimmer than it, or the full skylight column straight below)
+                and zero it. Brighter neighbors and emitters are sources and go to the add
+                queue.
+    Addition    flood from the add queue into cells that would become brighter.
+Skylight at full level travels down through clear blocks without loss, every other step
+costs one level plus the opacity of the block entered.
+
+Every changed light value marks the sections meshing that cell (across chunk borders), so
+only those sections are remeshed. Light never travels further than a chunk, so an update
+resolves the 3x3 chunks around it once instead of searching the chunk table per cell.
+
+---------------------------------------------------------------------------------
+*/
+
+//----------------------------------------------------------------------------------
+// Local Constants
+//----------------------------------------------------------------------------------
+#define DIRECTION_DOWN  2       // Index of {0, -1, 0} in neighborOffsets
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct {
+    int x, y, z;                // World position (chunk local for generation fills)
+    int level;                  // Light the cell had (removal queue only)
+} LightEntry;
+
+// Growable FIFO, drained completely by every update
+typedef struct {
+    LightEntry* entries;
+    int head;
+    int tail;
+    int capacity;
+} LightQueue;
+
+// A world cell resolved to its chunk
+typedef struct {
+    Chunk* chunk;
+    int x, y, z;                // Local coordinates
+} LightCell;
+
+// Chunks an update can reach, cells outside read as unloaded
+typedef struct {
+    ChunkPos center;
+    int originX, originZ;       // World position of the region corner (west north chunk)
+    Chunk* chunks[3][3];        // [x + 1][z + 1] offset from the center, NULL if not generated
+} LightRegion;
+
+//----------------------------------------------------------------------------------
+// Local Variables
+//----------------------------------------------------------------------------------
+static LightQueue removeQueue = {0};        // Simulation thread only
+static LightQueue addQueue = {0};
+static LightRegion region = {0};
+static int cellsChanged = 0;
+static LightingStats stats = {0};
+
+static const BlockPos neighborOffsets[6] = { {-1, 0, 0}, {1, 0, 0}, {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1} };
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions
+//----------------------------------------------------------------------------------
+static void PushLight(LightQueue* queue, int x, int y, int z, int level) {
+    if (queue->tail >= queue->capacity) {
+        queue->capacity = (queue->capacity > 0)? queue->capacity*2 : 4096;
+        queue->entries = (LightEntry*)realloc(queue->entries, queue->capacity*sizeof(LightEntry));
+    }
+    queue->entries[queue->tail++] = (LightEntry){ x, y, z, level };
+}
+
+// Level a neighbor receives from a cell, full skylight falls through clear blocks unchanged
+static int GetPropagatedLevel(LightChannel channel, int level, BlockType target, int direction) {
+    int opacity = GetBlockLightOpacity(target);
+    if ((channel == LIGHT_SKY) && (direction == DIRECTION_DOWN) && (level == MAX_LIGHT_LEVEL) && (opacity == 0)) return MAX_LIGHT_LEVEL;
+    return level - 1 - opacity;
+}
+
+static void LoadLightRegion(VoxelWorld* world, ChunkPos center) {
+    region.center = center;
+    region.originX = (center.x - 1)*CHUNK_SIZE;
+    region.originZ = (center.z - 1)*CHUNK_SIZE;
+    for (int dx = -1; dx <= 1; dx++) {
+        for (int dz = -1; dz <= 1; dz++) {
+            region.chunks[dx + 1][dz + 1] = GetChunk(world, (ChunkPos){ center.x + dx, center.z + dz });
+        }
+    }
+}
+
+static Chunk* GetRegionChunk(int chunkX, int chunkZ) {
+    int i = chunkX - region.center.x + 1;
+    int k = chunkZ - region.center.z + 1;
+    if ((i < 0) || (i > 2) || (k < 0) || (k > 2)) return NULL;
+    return region.chunks[i][k];
+}
+
+static bool ResolveCell(int x, int y, int z, LightCell* cell) {
+    // Region relative coordinates are never negative, chunk and local parts split without floor division
+    unsigned int regionX = (unsigned int)(x - region.originX);
+    unsigned int regionZ = (unsigned int)(z - region.originZ);
+    if ((regionX >= 3*CHUNK_SIZE) || (regionZ >= 3*CHUNK_SIZE) || ((unsigned int)y >= WORLD_HEIGHT)) return false;
+
+    Chunk* chunk = region.chunks[regionX/CHUNK_SIZE][regionZ/CHUNK_SIZE];
+    if (!chunk) return false;
+
+    cell->chunk = chunk;
+    cell->x = regionX % CHUNK_SIZE;
+    cell->y = y;
+    cell->z = regionZ % CHUNK_SIZE;
+    return true;
+}
+
+// Same marking as MarkBlockDirty(), neighbors come from the region
+static void SetCellLight(LightChannel channel, const LightCell* cell, int level) {
+    SetChunkLight(cell->chunk, channel, cell->x, cell->y, cell->z, level);
+    cell->chunk->dirtySections |= GetSectionMask(cell->y);
+    cellsChanged++;
+
+    // Faces of the neighbor chunks look into border cells, from the sections above and below too,
+    // and the diagonal chunk reads corner columns for its smooth light
+    unsigned int section = GetSectionMask(cell->y);
+    ChunkPos position = cell->chunk->position;
+    int dx = (cell->x == 0)? -1 : (cell->x == CHUNK_SIZE - 1)? 1 : 0;
+    int dz = (cell->z == 0)? -1 : (cell->z == CHUNK_SIZE - 1)? 1 : 0;
+    Chunk* neighbor = NULL;
+    if (dx && (neighbor = GetRegionChunk(position.x + dx, position.z))) neighbor->dirtySections |= section;
+    if (dz && (neighbor = GetRegionChunk(position.x, position.z + dz))) neighbor->dirtySections |= section;
+    if (dx && dz && (neighbor = GetRegionChunk(position.x + dx, position.z + dz))) neighbor->dirtySections |= section;
+}
+
+// Flood the add queue into every cell it brightens
+static void PropagateAdditions(LightChannel channel) {
+    while (addQueue.head < addQueue.tail) {
+        LightEntry entry = addQueue.entries[addQueue.head++];
+
+        LightCell cell;
+        if (!ResolveCell(entry.x, entry.y, entry.z, &cell)) continue;
+        int level = GetChunkLight(cell.chunk, channel, cell.x, cell.y, cell.z);
+        if (level <= 1) continue;
+
+        for (int d = 0; d < 6; d++) {
+            int x = entry.x + neighborOffsets[d].x;
+            int y = entry.y + neighborOffsets[d].y;
+            int z = entry.z + neighborOffsets[d].z;
+
+            LightCell neighbor;
+            if (!ResolveCell(x, y, z, &neighbor)) continue;
+
+            BlockType block = neighbor.chunk->blocks[neighbor.x][neighbor.y][neighbor.z];
+            int propagated = GetPropagatedLevel(channel, level, block, d);
+            if (propagated <= GetChunkLight(neighbor.chunk, channel, neighbor.x, neighbor.y, neighbor.z)) continue;
+
+            SetCellLight(channel, &neighbor, propagated);
+            PushLight(&addQueue, x, y, z, 0);
+        }
+    }
+
+    addQueue.head = addQueue.tail = 0;
+}
+
+// Flood a chunk local queue of lit cells through the chunk only
+static void FloodChunkLight(Chunk* chunk, LightChannel channel, LightQueue* queue) {
+    while (queue->head < queue->tail) {
+        LightEntry entry = queue->entries[queue->head++];
+
+        int level = GetChunkLight(chunk, channel, entry.x, entry.y, entry.z);
+        if (level <= 1) continue;
+
+        for (int d = 0; d < 6; d++) {
+            int x = entry.x + neighborOffsets[d].x;
+            int y = entry.y + neighborOffsets[d].y;
+            int z = entry.z + neighborOffsets[d].z;
+            if ((x < 0) || (x >= CHUNK_SIZE) || (z < 0) || (z >= CHUNK_SIZE) || (y < 0) || (y >= WORLD_HEIGHT)) continue;
+
+            int propagated = GetPropagatedLevel(channel, level, chunk->blocks[x][y][z], d);
+            if (propagated <= GetChunkLight(chunk, channel, x, y, z)) continue;
+
+            SetChunkLight(chunk, channel, x, y, z, propagated);
+            PushLight(queue, x, y, z, 0);
+        }
+    }
+
+    queue->head = queue->tail = 0;
+}
+
+// Two queue relight of one channel around an edited cell
+static void RelightChannel(LightChannel channel, const LightCell* origin, BlockPos position) {
+    // Removal: darken the cell and everything that was lit through it
+    int previous = GetChunkLight(origin->chunk, channel, origin->x, origin->y, origin->z);
+    if (previous > 0) SetCellLight(channel, origin, 0);
+    PushLight(&removeQueue, position.x, position.y, position.z, previous);
+
+    while (removeQueue.head < removeQueue.tail) {
+        LightEntry entry = removeQueue.entries[removeQueue.head++];
+
+        for (int d = 0; d < 6; d++) {
+            int x = entry.x + neighborOffsets[d].x;
+            int y = entry.y + neighborOffsets[d].y;
+            int z = entry.z + neighborOffsets[d].z;
+
+            LightCell neighbor;
+            if (!ResolveCell(x, y, z, &neighbor)) continue;
+
+            int level = GetChunkLight(neighbor.chunk, channel, neighbor.x, neighbor.y, neighbor.z);
+            if (level == 0) continue;
+
+            // Cells at the top of the world are lit by the sky itself, emitters by themselves
+            BlockType block = neighbor.chunk->blocks[neighbor.x][neighbor.y][neighbor.z];
+            bool selfLit = (channel == LIGHT_SKY)? ((y == WORLD_HEIGHT - 1) && (GetBlockLightOpacity(block) == 0)) :
+                                                   (GetBlockLightEmission(block) >= level);
+            bool dependent = (level < entry.level) ||
+                             ((channel == LIGHT_SKY) && (d == DIRECTION_DOWN) && (entry.level == MAX_LIGHT_LEVEL) && (level == MAX_LIGHT_LEVEL));
+
+            if (dependent && !selfLit) {
+                SetCellLight(channel, &neighbor, 0);
+                PushLight(&removeQueue, x, y, z, level);
+
+                // A dimmer emitter lit through the removed region keeps its own light
+                int emission = (channel == LIGHT_BLOCK)? GetBlockLightEmission(block) : 0;
+                if (emission > 0) {
+                    SetCellLight(channel, &neighbor, emission);
+                    PushLight(&addQueue, x, y, z, 0);
+                }
+            } else {
+                PushLight(&addQueue, x, y, z, 0);
+            }
+        }
+    }
+    removeQueue.head = removeQueue.tail = 0;
+
+    // The edited cell itself may be open to the sky or a new emitter
+    BlockType block = origin->chunk->blocks[origin->x][origin->y][origin->z];
+    int level = (channel == LIGHT_BLOCK)? GetBlockLightEmission(block) :
+                (position.y == WORLD_HEIGHT - 1)? GetPropagatedLevel(channel, MAX_LIGHT_LEVEL, block, DIRECTION_DOWN) : 0;
+    if (level > GetChunkLight(origin->chunk, channel, origin->x, origin->y, origin->z)) {
+        SetCellLight(channel, origin, level);
+        PushLight(&addQueue, position.x, position.y, position.z, 0);
+    }
+
+    // Addition: refill from the surviving light around the removed region
+    PropagateAdditions(channel);
+}
+
+//----------------------------------------------------------------------------------
+// Lighting Functions
+//----------------------------------------------------------------------------------
+void ComputeChunkLight(Chunk* chunk) {
+    memset(chunk->skyLight, 0, sizeof(chunk->skyLight));
+    memset(chunk->blockLight, 0, sizeof(chunk->blockLight));
+
+    // NOTE: Local queue, generation jobs run on several workers at once
+    LightQueue queue = { 0 };
+
+    // Heightmap: lowest y with nothing that blocks or dims light above it
+    unsigned char heightMap[CHUNK_SIZE][CHUNK_SIZE];
+    for (int x = 0; x < CHUNK_SIZE; x++) {
+        for (int z = 0; z < CHUNK_SIZE; z++) {
+            int height = 0;
+            for (int y = WORLD_HEIGHT - 1; y >= 0; y--) {
+                if (GetBlockLightOpacity(chunk->blocks[x][y][z]) > 0) {
+                    height = y + 1;
+                    break;
+                }
+            }
+
+            heightMap[x][z] = (unsigned char)height;
+            for (int y = height; y < WORLD_HEIGHT; y++) SetChunkLight(chunk, LIGHT_SKY, x, y, z, MAX_LIGHT_LEVEL);
+        }
+    }
+
+    // Seed the sky fill where open sky borders shade: the column top and the cells next to taller columns
+    for (int x = 0; x < CHUNK_SIZE; x++) {
+        for (int z = 0; z < CHUNK_SIZE; z++) {
+            int height = heightMap[x][z];
+            int shadeTop = height + 1;
+            if ((x > 0) && (heightMap[x - 1][z] > shadeTop)) shadeTop = heightMap[x - 1][z];
+            if ((x < CHUNK_SIZE - 1) && (heightMap[x + 1][z] > shadeTop)) shadeTop = heightMap[x + 1][z];
+            if ((z > 0) && (heightMap[x][z - 1] > shadeTop)) shadeTop = heightMap[x][z - 1];
+            if ((z < CHUNK_SIZE - 1) && (heightMap[x][z + 1] > shadeTop)) shadeTop = heightMap[x][z + 1];
+            if (shadeTop > WORLD_HEIGHT) shadeTop = WORLD_HEIGHT;
+
+            for (int y = height; y < shadeTop; y++) PushLight(&queue, x, y, z, 0);
+        }
+    }
+    FloodChunkLight(chunk, LIGHT_SKY, &queue);
+
+    // Emitters light their own cell and seed the block light fill
+    for (int x = 0; x < CHUNK_SIZE; x++) {
+        for (int y = 0; y < WORLD_HEIGHT; y++) {
+            for (int z = 0; z < CHUNK_SIZE; z++) {
+                int emission = GetBlockLightEmission(chunk->blocks[x][y][z]);
+                if (emission == 0) continue;
+
+                SetChunkLight(chunk, LIGHT_BLOCK, x, y, z, emission);
+                PushLight(&queue, x, y, z, 0);
+            }
+        }
+    }
+    FloodChunkLight(chunk, LIGHT_BLOCK, &queue);
+
+    free(queue.entries);
+}
+
+void StitchChunkLight(VoxelWorld* world, Chunk* chunk) {
+    const ChunkPos offsets[4] = { {-1, 0}, {1, 0}, {0, -1}, {0, 1} };
+    const int directions[4] = { 0, 1, 4, 5 };       // neighborOffsets index of each offset
+
+    LoadLightRegion(world, chunk->position);
+    int baseX = chunk->position.x*CHUNK_SIZE;
+    int baseZ = chunk->position.z*CHUNK_SIZE;
+
+    for (int channel = 0; channel < LIGHT_CHANNELS; channel++) {
+        for (int i = 0; i < 4; i++) {
+            Chunk* neighbor = GetRegionChunk(chunk->position.x + offsets[i].x, chunk->position.z + offsets[i].z);
+            if (!neighbor) continue;
+
+            for (int k = 0; k < CHUNK_SIZE; k++) {
+                // Border cell of this chunk and the touching cell of the neighbor, local coordinates
+                int ax = (offsets[i].x < 0)? 0 : (offsets[i].x > 0)? CHUNK_SIZE - 1 : k;
+                int az = (offsets[i].z < 0)? 0 : (offsets[i].z > 0)? CHUNK_SIZE - 1 : k;
+                int bx = (offsets[i].x != 0)? CHUNK_SIZE - 1 - ax : ax;
+                int bz = (offsets[i].z != 0)? CHUNK_SIZE - 1 - az : az;
+
+                for (int y = 0; y < WORLD_HEIGHT; y++) {
+                    int levelA = GetChunkLight(chunk, channel, ax, y, az);
+                    int levelB = GetChunkLight(neighbor, channel, bx, y, bz);
+
+                    // Only cells that would brighten the other side start a fill
+                    if (GetPropagatedLevel(channel, levelA, neighbor->blocks[bx][y][bz], directions[i]) > levelB) {
+                        PushLight(&addQueue, baseX + ax, y, baseZ + az, 0);
+                    }
+                    if (GetPropagatedLevel(channel, levelB, chunk->blocks[ax][y][az], directions[i] ^ 1) > levelA) {
+                        PushLight(&addQueue, neighbor->position.x*CHUNK_SIZE + bx, y, neighbor->position.z*CHUNK_SIZE + bz, 0);
+                    }
+                }
+            }
+        }
+
+        PropagateAdditions(channel);
+    }
+}
+
+void UpdateLightAt(VoxelWorld* world, BlockPos position, BlockType previous) {
+    double startTime = GetTime();
+    cellsChanged = 0;
+
+    LoadLightRegion(world, WorldToChunk((Vector3){ position.x, position.y, position.z }));
+
+    LightCell origin;
+    if (!ResolveCell(position.x, position.y, position.z, &origin)) return;
+    BlockType block = origin.chunk->blocks[origin.x][origin.y][origin.z];
+
+    // Skylight only depends on opacity, block light also on emission
+    bool opacityChanged = GetBlockLightOpacity(previous) != GetBlockLightOpacity(block);
+    if (opacityChanged) RelightChannel(LIGHT_SKY, &origin, position);
+    if (opacityChanged || (GetBlockLightEmission(previous) != GetBlockLightEmission(block))) {
+        RelightChannel(LIGHT_BLOCK, &origin, position);
+    }
+
+    stats.cellsChanged = cellsChanged;
+    stats.updateTime = (float)((GetTime() - startTime)*1000.0);
+}
+
+int GetLight(VoxelWorld* world, LightChannel channel, BlockPos position) {
+    int openLevel = (channel == LIGHT_SKY)? MAX_LIGHT_LEVEL : 0;
+    if (position.y >= WORLD_HEIGHT) return openLevel;
+    if (position.y < 0) return 0;
+
+    ChunkPos chunkPos = WorldToChunk((Vector3){ position.x, position.y, position.z });
+    Chunk* chunk = GetChunk(world, chunkPos);
+    if (!chunk) return openLevel;
+
+    return GetChunkLight(chunk, channel, position.x - chunkPos.x*CHUNK_SIZE, position.y, position.z - chunkPos.z*CHUNK_SIZE);
+}
+
+int GetNeighborhoodLight(const ChunkNeighborhood* neighborhood, LightChannel channel, int x, int y, int z) {
+    int openLevel = (channel == LIGHT_SKY)? MAX_LIGHT_LEVEL : 0;
+    if (y >= WORLD_HEIGHT) return openLevel;
+    if (y < 0) return 0;
+
+    // Missing neighbors read as open daylight rather than black seams
+    const Chunk* chunk = GetNeighborhoodColumn(neighborhood, &x, &z);
+    if (!chunk) return openLevel;
+
+    return GetChunkLight(chunk, channel, x, y, z);
+}
+
+LightingStats GetLightingStats(void) {
+    return stats;
+}
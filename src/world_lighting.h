@@ -0,0 +1,61 @@
+#ifndef WORLD_LIGHTING_H
+#define WORLD_LIGHTING_H
+
+#include "voxel_types.h"
+#include "voxel_world.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    LIGHT_SKY = 0,              // Sunlight from the top of the world
+    LIGHT_BLOCK,                // Light emitted by blocks (glowstone, lanterns...)
+    LIGHT_CHANNELS
+} LightChannel;
+
+typedef struct {
+    int cellsChanged;           // Light values rewritten by the last incremental update
+    float updateTime;           // Milliseconds spent in the last incremental update
+} LightingStats;
+
+//----------------------------------------------------------------------------------
+// Light Storage
+// NOTE: Section arrays hold two levels per byte, x fastest then z then y within the section
+//----------------------------------------------------------------------------------
+static inline int GetLightNibbleIndex(int x, int y, int z)
+{
+    return ((y % CHUNK_SECTION_HEIGHT)*CHUNK_SIZE + z)*CHUNK_SIZE + x;
+}
+
+static inline int GetChunkLight(const Chunk* chunk, LightChannel channel, int x, int y, int z)
+{
+    int index = GetLightNibbleIndex(x, y, z);
+    const unsigned char* section = (channel == LIGHT_SKY)? chunk->skyLight[y/CHUNK_SECTION_HEIGHT] : chunk->blockLight[y/CHUNK_SECTION_HEIGHT];
+    unsigned char pair = section[index >> 1];
+    return (index & 1)? (pair >> 4) : (pair & 0x0F);
+}
+
+static inline void SetChunkLight(Chunk* chunk, LightChannel channel, int x, int y, int z, int level)
+{
+    int index = GetLightNibbleIndex(x, y, z);
+    unsigned char* section = (channel == LIGHT_SKY)? chunk->skyLight[y/CHUNK_SECTION_HEIGHT] : chunk->blockLight[y/CHUNK_SECTION_HEIGHT];
+    unsigned char* pair = &section[index >> 1];
+    *pair = (index & 1)? (unsigned char)((*pair & 0x0F) | (level << 4)) : (unsigned char)((*pair & 0xF0) | level);
+}
+
+//----------------------------------------------------------------------------------
+// Lighting Functions
+//----------------------------------------------------------------------------------
+void ComputeChunkLight(Chunk* chunk);                                   // Chunk local flood fill of both channels, any thread
+void StitchChunkLight(VoxelWorld* world, Chunk* chunk);                 // Spread light across borders with generated neighbors
+void UpdateLightAt(VoxelWorld* world, BlockPos position, BlockType previous);   // Incremental relight after a block edit
+int GetLight(VoxelWorld* world, LightChannel channel, BlockPos position);
+int GetNeighborhoodLight(const ChunkNeighborhood* neighborhood, LightChannel channel, int x, int y, int z);  // Local coords, as GetNeighborhoodBlock()
+LightingStats GetLightingStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // WORLD_LIGHTING_H